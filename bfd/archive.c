@@ -760,6 +760,7 @@ _bfd_get_elt_at_filepos (bfd *archive, file_ptr filepos,
     }
   else
     {
+      bfd_cache_map_archive (archive);
       n_bfd = _bfd_create_empty_archive_element_shell (archive);
     }
 
@@ -2250,6 +2250,11 @@ struct bfd
 
   /* For input BFDs, the build ID, if the object has one. */
   const struct bfd_build_id *build_id;
+
+  /* A read-only mapping of the file holding this BFD, shared with the
+     containing archive and its other elements.  Created on demand by
+     bfd_get_section_contents_view.  */
+  struct bfd_file_view *file_view;
 };
 
 static inline const char *
@@ -2754,10 +2759,31 @@ bool bfd_get_file_window
    (bfd *, file_ptr, bfd_size_type, bfd_window *, bool /*writable*/);
 
 /* Extracted from cache.c.  */
+/* Counters kept by the file descriptor cache, see
+   bfd_get_cache_stats.  */
+struct bfd_cache_stats
+{
+  /* Lookups which found the file already open.  */
+  unsigned long hits;
+  /* Files which had to be opened, including the first open.  */
+  unsigned long misses;
+  /* Of those, files which had been closed before.  */
+  unsigned long reopens;
+  /* Files closed to stay within the open file limit.  */
+  unsigned long evictions;
+  /* Archives read through a memory mapping, and their total size.  */
+  unsigned int mapped_archives;
+  bfd_size_type mapped_size;
+  /* The open file limit.  */
+  int max_open;
+};
+
 bool bfd_cache_close (bfd *abfd);
 
 bool bfd_cache_close_all (void);
 
+void bfd_get_cache_stats (struct bfd_cache_stats *stats, bool reset);
+
 /* Extracted from compress.c.  */
 /* Types of compressed DWARF debug sections.  */
 enum compressed_debug_section_type
@@ -2784,6 +2810,17 @@ enum compression_type
   ch_compress_zstd = 2         /* Compressed with zstd (www.zstandard.org).  */
 };
 
+/* Totals for the sections compressed so far, see
+   bfd_get_compression_stats.  */
+struct bfd_compression_stats
+{
+  unsigned int sections;
+  bfd_size_type uncompressed_size;
+  bfd_size_type compressed_size;
+  /* CPU time spent compressing, in microseconds.  */
+  long usec;
+};
+
 static inline char *
 bfd_debug_name_to_zdebug (bfd *abfd, const char *name)
 {
@@ -2831,6 +2868,11 @@ bool bfd_convert_section_contents
 bool bfd_get_full_section_contents
    (bfd *abfd, asection *section, bfd_byte **ptr);
 
+bool bfd_get_section_contents_view
+   (bfd *abfd, asection *section, bfd_byte **ptr);
+
+void bfd_release_section_contents_view (bfd *abfd, bfd_byte *ptr);
+
 bool bfd_is_section_compressed_info
    (bfd *abfd, asection *section,
     int *compression_header_size_p,
@@ -2850,6 +2892,10 @@ bool bfd_init_section_compress_status
 bool bfd_compress_section
    (bfd *abfd, asection *section, bfd_byte *uncompressed_buffer);
 
+const struct bfd_compression_stats *bfd_get_compression_stats (void);
+
+void bfd_set_compression_threads (unsigned int threads);
+
 /* Extracted from corefile.c.  */
 const char *bfd_core_file_failing_command (bfd *abfd);
 
@@ -380,6 +380,11 @@ CODE_FRAGMENT
 .
 .  {* For input BFDs, the build ID, if the object has one. *}
 .  const struct bfd_build_id *build_id;
+.
+.  {* A read-only mapping of the file holding this BFD, shared with the
+.     containing archive and its other elements.  Created on demand by
+.     bfd_get_section_contents_view.  *}
+.  struct bfd_file_view *file_view;
 .};
 .
 
@@ -30,6 +30,9 @@
 #include <windows.h>
 #include <locale.h>
 #endif
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
 
 #ifndef S_IXUSR
 #define S_IXUSR 0100    /* Execute by owner.  */
@@ -647,6 +650,165 @@ bfd_mmap (bfd *abfd, void *addr, bfd_size_type len,
 			     map_addr, map_len);
 }
 
+/*
+INTERNAL_DEFINITION
+	struct bfd_file_view
+
+DESCRIPTION
+	A <<struct bfd_file_view>> describes a read-only mapping of a
+	whole file.  It is shared by the BFD that owns the file and by
+	any archive elements read from it, and is unmapped when the
+	last of those BFDs is closed.
+
+.struct bfd_file_view
+.{
+.  {* The start and size of the file in memory.  BASE is NULL if the
+.     file could not be mapped.  *}
+.  void *base;
+.  bfd_size_type size;
+.  {* The page aligned region to pass to munmap.  *}
+.  void *map_addr;
+.  bfd_size_type map_len;
+.  {* The number of BFDs pointing at this view.  *}
+.  unsigned int refcount;
+.  {* Set by bfd_cache_map_archive: reads of the archive owning this
+.     view are served from the mapping instead of the file.  *}
+.  bool serves_reads;
+.};
+.
+*/
+
+/*
+INTERNAL_FUNCTION
+	_bfd_get_file_view
+
+SYNOPSIS
+	struct bfd_file_view *_bfd_get_file_view
+	  (bfd *abfd, file_ptr *origin);
+
+DESCRIPTION
+	Return the read-only mapping of the file holding @var{abfd},
+	mapping it first if needed, and store the offset of @var{abfd}
+	within the mapping in @var{*origin}.  Return NULL if the file
+	cannot be mapped.
+*/
+
+struct bfd_file_view *
+_bfd_get_file_view (bfd *abfd, file_ptr *origin)
+{
+  struct bfd_file_view *view = abfd->file_view;
+  file_ptr offset = 0;
+  bfd *owner = abfd;
+
+  while (owner->my_archive != NULL
+	 && !bfd_is_thin_archive (owner->my_archive))
+    {
+      offset += owner->origin;
+      owner = owner->my_archive;
+    }
+  offset += owner->origin;
+  *origin = offset;
+
+  /* Elements with their own I/O methods, eg. compressed members of
+     VMS libraries, don't see the raw bytes of the archive.  */
+  if (abfd->iovec != owner->iovec)
+    return NULL;
+
+  if (view == NULL)
+    {
+      view = owner->file_view;
+      if (view == NULL)
+	{
+	  view = (struct bfd_file_view *) bfd_zmalloc (sizeof (*view));
+	  if (view == NULL)
+	    return NULL;
+#ifdef HAVE_MMAP
+	  if (owner->direction == read_direction
+	      && (owner->flags & BFD_IN_MEMORY) == 0
+	      && owner->iovec != NULL)
+	    {
+	      ufile_ptr filesize = bfd_get_size (owner);
+	      void *base;
+
+	      if (filesize != 0)
+		{
+		  base = owner->iovec->bmmap (owner, NULL, filesize,
+					      PROT_READ, MAP_PRIVATE, 0,
+					      &view->map_addr,
+					      &view->map_len);
+		  if (base != (void *) -1)
+		    {
+		      view->base = base;
+		      view->size = filesize;
+		    }
+		}
+	    }
+#endif
+	  view->refcount = 1;
+	  owner->file_view = view;
+	}
+      if (abfd != owner)
+	{
+	  view->refcount++;
+	  abfd->file_view = view;
+	}
+    }
+
+  return view->base != NULL ? view : NULL;
+}
+
+/*
+INTERNAL_FUNCTION
+	_bfd_file_view_contains
+
+SYNOPSIS
+	bool _bfd_file_view_contains (bfd *abfd, const void *ptr);
+
+DESCRIPTION
+	Return TRUE if @var{ptr} points into the file mapping of
+	@var{abfd}.
+*/
+
+bool
+_bfd_file_view_contains (bfd *abfd, const void *ptr)
+{
+  struct bfd_file_view *view = abfd->file_view;
+
+  return (view != NULL
+	  && view->base != NULL
+	  && (const char *) ptr >= (const char *) view->base
+	  && (const char *) ptr < (const char *) view->base + view->size);
+}
+
+/*
+INTERNAL_FUNCTION
+	_bfd_free_file_view
+
+SYNOPSIS
+	void _bfd_free_file_view (bfd *abfd);
+
+DESCRIPTION
+	Drop the reference @var{abfd} holds on its file mapping, and
+	unmap the file if this was the last one.
+*/
+
+void
+_bfd_free_file_view (bfd *abfd)
+{
+  struct bfd_file_view *view = abfd->file_view;
+
+  if (view == NULL)
+    return;
+  abfd->file_view = NULL;
+  if (--view->refcount != 0)
+    return;
+#ifdef HAVE_MMAP
+  if (view->base != NULL)
+    munmap (view->map_addr, view->map_len);
+#endif
+  free (view);
+}
+
 /* Memory file I/O operations.  */
 
 static file_ptr
@@ -196,6 +196,7 @@ bfd_get_file_window (bfd *abfd,
       file_ptr file_offset, offset2;
       size_t real_size;
       int fd;
+      struct stat st;
 
       /* Find the real file and the real offset into it.  */
       while (abfd->my_archive != NULL
@@ -206,10 +207,12 @@ bfd_get_file_window (bfd *abfd,
 	}
       offset += abfd->origin;
 
-      /* Seek into the file, to ensure it is open if cacheable.  */
+      /* Stat the file, to ensure it is open if cacheable.  Seeking
+	 does not reopen a file whose reads the cache serves from a
+	 mapping.  */
       if (abfd->iostream == NULL
 	  && (abfd->iovec == NULL
-	      || abfd->iovec->bseek (abfd, offset, SEEK_SET) != 0))
+	      || abfd->iovec->bstat (abfd, &st) != 0))
 	goto free_and_fail;
 
       fd = fileno ((FILE *) abfd->iostream);
@@ -36,6 +36,12 @@ SECTION
 	close, closes it and opens the one wanted, returning its file
 	handle.
 
+	Non-thin archive members have no stream of their own; all
+	reads go through the containing archive.  When the first
+	member of an archive opened for reading is accessed, the whole
+	file is mapped into memory and closed, so that pulling in many
+	members from many archives does not keep reopening them.
+
 SUBSECTION
 	Caching functions
 */
@@ -64,6 +70,31 @@ enum cache_flag {
   CACHE_NO_SEEK_ERROR = 4
 };
 
+/*
+EXTERNAL
+.{* Counters kept by the file descriptor cache, see
+.   bfd_get_cache_stats.  *}
+.struct bfd_cache_stats
+.{
+.  {* Lookups which found the file already open.  *}
+.  unsigned long hits;
+.  {* Files which had to be opened, including the first open.  *}
+.  unsigned long misses;
+.  {* Of those, files which had been closed before.  *}
+.  unsigned long reopens;
+.  {* Files closed to stay within the open file limit.  *}
+.  unsigned long evictions;
+.  {* Archives read through a memory mapping, and their total size.  *}
+.  unsigned int mapped_archives;
+.  bfd_size_type mapped_size;
+.  {* The open file limit.  *}
+.  int max_open;
+.};
+.
+*/
+
+static struct bfd_cache_stats cache_stats;
+
 /* The maximum number of files which the cache will keep open at
    one time.  When needed call bfd_cache_max_open to initialize.  */
 
@@ -182,6 +213,21 @@ bfd_cache_delete (bfd *abfd)
   return ret;
 }
 
+/* Return the read-only mapping of ABFD's file, if ABFD is an archive
+   mapped by bfd_cache_map_archive.  Reads are then served from the
+   mapping, and the position in the file is kept in ABFD->where alone.
+   Other files keep reading through their stream, even if some of
+   their sections were mapped by bfd_get_section_contents_view.  */
+
+static inline bfd_byte *
+cache_view (bfd *abfd)
+{
+  struct bfd_file_view *view = abfd->file_view;
+
+  return (view != NULL && view->serves_reads
+	  ? (bfd_byte *) view->base : NULL);
+}
+
 /* We need to open a new file, and the cache is full.  Find the least
    recently used cacheable BFD and close it.  */
 
@@ -212,7 +258,9 @@ close_one (void)
       return true;
     }
 
-  to_kill->where = _bfd_real_ftell ((FILE *) to_kill->iostream);
+  if (cache_view (to_kill) == NULL)
+    to_kill->where = _bfd_real_ftell ((FILE *) to_kill->iostream);
+  cache_stats.evictions++;
 
   return bfd_cache_delete (to_kill);
 }
@@ -224,7 +272,8 @@ close_one (void)
 
 #define bfd_cache_lookup(x, flag) \
   ((x) == bfd_last_cache			\
-   ? (FILE *) (bfd_last_cache->iostream)	\
+   ? (cache_stats.hits++,			\
+      (FILE *) (bfd_last_cache->iostream))	\
    : bfd_cache_lookup_worker (x, flag))
 
 /* Called when the macro <<bfd_cache_lookup>> fails to find a
@@ -246,6 +295,7 @@ bfd_cache_lookup_worker (bfd *abfd, enum cache_flag flag)
 
   if (abfd->iostream != NULL)
     {
+      cache_stats.hits++;
       /* Move the file to the start of the cache.  */
       if (abfd != bfd_last_cache)
 	{
@@ -277,7 +327,12 @@ bfd_cache_lookup_worker (bfd *abfd, enum cache_flag flag)
 static file_ptr
 cache_btell (struct bfd *abfd)
 {
-  FILE *f = bfd_cache_lookup (abfd, CACHE_NO_OPEN);
+  FILE *f;
+
+  if (cache_view (abfd) != NULL)
+    return abfd->where;
+
+  f = bfd_cache_lookup (abfd, CACHE_NO_OPEN);
   if (f == NULL)
     return abfd->where;
   return _bfd_real_ftell (f);
@@ -286,7 +341,24 @@ cache_btell (struct bfd *abfd)
 static int
 cache_bseek (struct bfd *abfd, file_ptr offset, int whence)
 {
-  FILE *f = bfd_cache_lookup (abfd, whence != SEEK_CUR ? CACHE_NO_SEEK : CACHE_NORMAL);
+  FILE *f;
+
+  if (cache_view (abfd) != NULL)
+    {
+      /* bfd_seek keeps the position in WHERE; just check it.  */
+      if (whence == SEEK_CUR)
+	offset += abfd->where;
+      else if (whence == SEEK_END)
+	offset += abfd->file_view->size;
+      if (offset < 0)
+	{
+	  errno = EINVAL;
+	  return -1;
+	}
+      return 0;
+    }
+
+  f = bfd_cache_lookup (abfd, whence != SEEK_CUR ? CACHE_NO_SEEK : CACHE_NORMAL);
   if (f == NULL)
     return -1;
   return _bfd_real_fseek (f, offset, whence);
@@ -338,8 +410,24 @@ static file_ptr
 cache_bread (struct bfd *abfd, void *buf, file_ptr nbytes)
 {
   file_ptr nread = 0;
+  bfd_byte *map;
   FILE *f;
 
+  map = cache_view (abfd);
+  if (map != NULL)
+    {
+      if (abfd->where < abfd->file_view->size)
+	{
+	  nread = abfd->file_view->size - abfd->where;
+	  if (nread > nbytes)
+	    nread = nbytes;
+	  memcpy (buf, map + abfd->where, nread);
+	}
+      if (nread < nbytes)
+	bfd_set_error (bfd_error_file_truncated);
+      return nread;
+    }
+
   f = bfd_cache_lookup (abfd, CACHE_NORMAL);
   if (f == NULL)
     return -1;
@@ -503,11 +591,59 @@ bfd_cache_init (bfd *abfd)
     }
   abfd->iovec = &cache_iovec;
   insert (abfd);
+  cache_stats.misses++;
   abfd->flags &= ~BFD_CLOSED_BY_CACHE;
   ++open_files;
   return true;
 }
 
+/*
+INTERNAL_FUNCTION
+	bfd_cache_map_archive
+
+SYNOPSIS
+	void bfd_cache_map_archive (bfd *abfd);
+
+DESCRIPTION
+	Called when a member of the non-thin archive @var{abfd} is
+	about to be read.  If the archive file was opened for reading,
+	try once to map the whole file into memory, see
+	_bfd_get_file_view, unless that was already done for
+	bfd_get_section_contents_view.  If the archive is mapped, reads
+	of the archive and its members are served from the mapping and
+	the file is closed, so that it no longer takes up a slot in the
+	cache.  Only archives get this treatment.
+*/
+
+void
+bfd_cache_map_archive (bfd *abfd)
+{
+  struct bfd_file_view *view;
+  file_ptr origin;
+
+  while (abfd->my_archive != NULL
+	 && !bfd_is_thin_archive (abfd->my_archive))
+    abfd = abfd->my_archive;
+
+  if (abfd->iovec != &cache_iovec)
+    return;
+  view = abfd->file_view;
+  if (view != NULL && (view->base == NULL || view->serves_reads))
+    return;
+
+  view = _bfd_get_file_view (abfd, &origin);
+  if (view == NULL)
+    return;
+
+  view->serves_reads = true;
+  cache_stats.mapped_archives++;
+  cache_stats.mapped_size += view->size;
+
+  /* Reads no longer need the file descriptor.  */
+  if (abfd->cacheable && abfd->iostream != NULL)
+    bfd_cache_delete (abfd);
+}
+
 /*
 FUNCTION
 	bfd_cache_close
@@ -583,6 +719,9 @@ bfd_open_file (bfd *abfd)
 {
   abfd->cacheable = true;	/* Allow it to be closed later.  */
 
+  if ((abfd->flags & BFD_CLOSED_BY_CACHE) != 0)
+    cache_stats.reopens++;
+
   if (open_files >= bfd_cache_max_open ())
     {
       if (! close_one ())
@@ -650,3 +789,28 @@ bfd_open_file (bfd *abfd)
 
   return (FILE *) abfd->iostream;
 }
+
+/*
+FUNCTION
+	bfd_get_cache_stats
+
+SYNOPSIS
+	void bfd_get_cache_stats (struct bfd_cache_stats *stats, bool reset);
+
+DESCRIPTION
+	Store in @var{stats} how often the file descriptor cache found
+	a file open, had to open or reopen it, or closed one to make
+	room, how many archives it has mapped into memory, and the
+	number of files it keeps open at most.  The counts cover the
+	whole process, since it started or since the last call with
+	@var{reset} set, which starts them again from zero.
+*/
+
+void
+bfd_get_cache_stats (struct bfd_cache_stats *stats, bool reset)
+{
+  cache_stats.max_open = bfd_cache_max_open ();
+  *stats = cache_stats;
+  if (reset)
+    memset (&cache_stats, 0, sizeof (cache_stats));
+}
@@ -31,6 +31,16 @@
 
 #define MAX_COMPRESSION_HEADER_SIZE 24
 
+/* Sections at least this large are compressed by several of
+   libzstd's worker threads, each handling at least this much.  */
+#define ZSTD_MT_CHUNK_SIZE (1024 * 1024)
+
+static struct bfd_compression_stats compression_stats;
+
+/* Maximum number of libzstd worker threads, or 0 for one per online
+   processor; see bfd_set_compression_threads.  */
+static unsigned int compression_threads;
+
 /*
 EXTERNAL
 .{* Types of compressed DWARF debug sections.  *}
@@ -58,6 +68,17 @@ EXTERNAL
 .  ch_compress_zstd = 2		{* Compressed with zstd (www.zstandard.org).  *}
 .};
 .
+.{* Totals for the sections compressed so far, see
+.   bfd_get_compression_stats.  *}
+.struct bfd_compression_stats
+.{
+.  unsigned int sections;
+.  bfd_size_type uncompressed_size;
+.  bfd_size_type compressed_size;
+.  {* CPU time spent compressing, in microseconds.  *}
+.  long usec;
+.};
+.
 .static inline char *
 .bfd_debug_name_to_zdebug (bfd *abfd, const char *name)
 .{
@@ -553,6 +574,58 @@ decompress_contents (bool is_zstd, bfd_byte *compressed_buffer,
   return inflateEnd (&strm) == Z_OK && rc == Z_OK && strm.avail_out == 0;
 }
 
+#ifdef HAVE_ZSTD
+/* Compress SIZE bytes at INPUT into at most BUFFER_SIZE bytes at
+   BUFFER.  A large section is split into jobs of ZSTD_MT_CHUNK_SIZE
+   bytes that libzstd compresses concurrently on its worker threads;
+   the result is still a single frame, so readers see an ordinary
+   ch_compress_zstd payload.
+
+   The frame libzstd writes in this mode depends on the job size but
+   not on the number of workers, as long as there is at least one.
+   Every large section therefore takes this path with at least one
+   worker, even on a single processor, so that the output does not
+   depend on the host or on bfd_set_compression_threads.  Only a
+   libzstd built without thread support rejects the workers and
+   compresses serially.  */
+
+static size_t
+compress_zstd (bfd_byte *buffer, size_t buffer_size,
+	       const bfd_byte *input, size_t size)
+{
+  ZSTD_CCtx *cctx;
+  size_t ret;
+  long workers = 1;
+
+  if (size < 2 * ZSTD_MT_CHUNK_SIZE)
+    return ZSTD_compress (buffer, buffer_size, input, size,
+			  ZSTD_CLEVEL_DEFAULT);
+
+  if (compression_threads != 0)
+    workers = compression_threads;
+#if defined (HAVE_SYSCONF) && defined (_SC_NPROCESSORS_ONLN)
+  else
+    workers = sysconf (_SC_NPROCESSORS_ONLN);
+#endif
+  if ((size_t) workers > size / ZSTD_MT_CHUNK_SIZE)
+    workers = size / ZSTD_MT_CHUNK_SIZE;
+  if (workers < 1)
+    workers = 1;
+
+  cctx = ZSTD_createCCtx ();
+  if (cctx == NULL)
+    return (size_t) -1;
+  ZSTD_CCtx_setParameter (cctx, ZSTD_c_compressionLevel,
+			  ZSTD_CLEVEL_DEFAULT);
+  if (!ZSTD_isError (ZSTD_CCtx_setParameter (cctx, ZSTD_c_nbWorkers,
+					     workers)))
+    ZSTD_CCtx_setParameter (cctx, ZSTD_c_jobSize, ZSTD_MT_CHUNK_SIZE);
+  ret = ZSTD_compress2 (cctx, buffer, buffer_size, input, size);
+  ZSTD_freeCCtx (cctx);
+  return ret;
+}
+#endif
+
 /* Compress section contents using zlib/zstd and store
    as the contents field.  This function assumes the contents
    field was allocated using bfd_malloc() or equivalent.
@@ -580,6 +653,7 @@ bfd_compress_section_contents (bfd *abfd, sec_ptr sec)
 				      &uncompressed_alignment_pow,
 				      &ch_type);
   bool update = false;
+  long start_time = get_run_time ();
 
   /* We shouldn't be trying to decompress unsupported compressed sections.  */
   if (compressed && orig_header_size < 0)
@@ -650,11 +724,10 @@ bfd_compress_section_contents (bfd *abfd, sec_ptr sec)
       if (abfd->flags & BFD_COMPRESS_ZSTD)
 	{
 #if HAVE_ZSTD
-	  compressed_size = ZSTD_compress (buffer + new_header_size,
+	  compressed_size = compress_zstd (buffer + new_header_size,
 					   compressed_size,
 					   input_buffer,
-					   uncompressed_size,
-					   ZSTD_CLEVEL_DEFAULT);
+					   uncompressed_size);
 	  if (ZSTD_isError (compressed_size))
 	    {
 	      bfd_release (abfd, buffer);
@@ -693,6 +766,11 @@ bfd_compress_section_contents (bfd *abfd, sec_ptr sec)
   sec->contents = buffer;
   sec->flags |= SEC_IN_MEMORY;
   free (input_buffer);
+
+  compression_stats.sections++;
+  compression_stats.uncompressed_size += uncompressed_size;
+  compression_stats.compressed_size += sec->size;
+  compression_stats.usec += get_run_time () - start_time;
   return uncompressed_size;
 }
 
@@ -843,6 +921,80 @@ bfd_get_full_section_contents (bfd *abfd, sec_ptr sec, bfd_byte **ptr)
     }
 }
 
+/*
+FUNCTION
+	bfd_get_section_contents_view
+
+SYNOPSIS
+	bool bfd_get_section_contents_view
+	  (bfd *abfd, asection *section, bfd_byte **ptr);
+
+DESCRIPTION
+	Like bfd_get_full_section_contents, but if @var{section} is
+	stored uncompressed in a file that can be mapped, set
+	@var{*ptr} to point into a read-only mapping of the file rather
+	than reading the contents into a buffer.  In that case any
+	buffer passed in @var{*ptr} is left untouched.  The contents
+	must not be modified, and must be released with
+	bfd_release_section_contents_view.  The mapping stays valid
+	until @var{abfd} is closed.
+*/
+
+bool
+bfd_get_section_contents_view (bfd *abfd, sec_ptr sec, bfd_byte **ptr)
+{
+  bfd_size_type size = bfd_get_section_limit_octets (abfd, sec);
+  struct bfd_file_view *view;
+  file_ptr origin;
+  ufile_ptr filesize;
+
+  if (sec->compress_status != COMPRESS_SECTION_NONE
+      || (sec->flags & (SEC_HAS_CONTENTS | SEC_IN_MEMORY)) != SEC_HAS_CONTENTS
+      || size == 0
+      || size != bfd_get_section_alloc_size (abfd, sec)
+      || sec->filepos < 0
+      || (abfd->xvec->_bfd_get_section_contents
+	  != _bfd_generic_get_section_contents))
+    return bfd_get_full_section_contents (abfd, sec, ptr);
+
+  /* Apply the same sanity check as _bfd_generic_get_section_contents,
+     which also keeps archive elements within their own bytes.  */
+  filesize = bfd_get_file_size (abfd);
+  if (filesize != 0
+      && ((ufile_ptr) sec->filepos > filesize
+	  || size > filesize - sec->filepos))
+    return bfd_get_full_section_contents (abfd, sec, ptr);
+
+  view = _bfd_get_file_view (abfd, &origin);
+  if (view == NULL
+      || (ufile_ptr) (origin + sec->filepos) > view->size
+      || size > view->size - (origin + sec->filepos))
+    return bfd_get_full_section_contents (abfd, sec, ptr);
+
+  *ptr = (bfd_byte *) view->base + origin + sec->filepos;
+  return true;
+}
+
+/*
+FUNCTION
+	bfd_release_section_contents_view
+
+SYNOPSIS
+	void bfd_release_section_contents_view (bfd *abfd, bfd_byte *ptr);
+
+DESCRIPTION
+	Release section contents @var{ptr} returned for @var{abfd} by
+	bfd_get_section_contents_view.  Contents that were read into a
+	malloc'd buffer are freed; borrowed contents need no action.
+*/
+
+void
+bfd_release_section_contents_view (bfd *abfd, bfd_byte *ptr)
+{
+  if (!_bfd_file_view_contains (abfd, ptr))
+    free (ptr);
+}
+
 /*
 FUNCTION
 	bfd_is_section_compressed_info
@@ -1138,3 +1290,44 @@ bfd_compress_section (bfd *abfd, sec_ptr sec, bfd_byte *uncompressed_buffer)
     }
   return true;
 }
+
+/*
+FUNCTION
+	bfd_get_compression_stats
+
+SYNOPSIS
+	const struct bfd_compression_stats *bfd_get_compression_stats (void);
+
+DESCRIPTION
+	Return the number of sections compressed so far by this process,
+	their total size before and after compression, and the CPU time
+	spent compressing them.  Sections left uncompressed because
+	compression did not make them smaller count with their original
+	size.
+*/
+
+const struct bfd_compression_stats *
+bfd_get_compression_stats (void)
+{
+  return &compression_stats;
+}
+
+/*
+FUNCTION
+	bfd_set_compression_threads
+
+SYNOPSIS
+	void bfd_set_compression_threads (unsigned int threads);
+
+DESCRIPTION
+	Compress large zstd sections on at most @var{threads} of
+	libzstd's worker threads.  Zero, the default, uses one thread
+	per online processor.  The compressed contents do not depend
+	on this setting.
+*/
+
+void
+bfd_set_compression_threads (unsigned int threads)
+{
+  compression_threads = threads;
+}
@@ -71,6 +71,7 @@ unsigned long tricore_mask_ssro;
 unsigned long tricore_opmask[TRICORE_FMT_MAX];
 
 void tricore_init_arch_vars (unsigned long);
+int tricore_get_opmask (unsigned long, unsigned long *);
 
 /* Describe the various flavours of the TriCore architecture.  */
 
@@ -222,58 +223,56 @@ const bfd_arch_info_type bfd_tricore_arch =
   0				/* Maximum offset of a reloc from the start of an insn. */  
 };
 
-/* Initialize the architecture-specific variables.  This must be called
-   by the assembler and disassembler prior to encoding/decoding any
-   TriCore instructions;  the linker (or more precisely, the specific
-   back-end, bfd/elf32-tricore.c:tricore_elf32_relocate_section) will
-   also have to call this if it ever accesses the variables below, but
-   it currently doesn't.  */
+/* Store the opcode masks of all instruction formats of the TriCore
+   flavour MACH into OPMASK, which is indexed by tricore_fmt.  Entries
+   of formats which aren't supported by MACH are left untouched.  Return
+   zero (and leave OPMASK alone) if MACH is unknown.  Unlike
+   tricore_init_arch_vars, this doesn't touch any global state.  */
 
-void
-tricore_init_arch_vars (mach)
-     unsigned long mach;
+int
+tricore_get_opmask (unsigned long mach, unsigned long *opmask)
 {
   switch (mach & EF_EABI_TRICORE_CORE_MASK)
     {
     case EF_EABI_TRICORE_V1_1:
-      tricore_mask_abs =  0x0c0000ff;
-      tricore_mask_absb = 0x0c0000ff;
-      tricore_mask_b =    0x000000ff;
-      tricore_mask_bit =  0x006000ff;
-      tricore_mask_bo =   0x0fc000ff;
-      tricore_mask_bol =  0x000000ff;
-      tricore_mask_brc =  0x800000ff;
-      tricore_mask_brn =  0x8000007f;
-      tricore_mask_brr =  0x800000ff;
-      tricore_mask_rc =   0x0fe000ff;
-      tricore_mask_rcpw = 0x006000ff;
-      tricore_mask_rcr =  0x00e000ff;
-      tricore_mask_rcrr = 0x00e000ff;
-      tricore_mask_rcrw = 0x00e000ff;
-      tricore_mask_rlc =  0x000000ff;
-      tricore_mask_rr =   0x0ff000ff;
-      tricore_mask_rrpw = 0x006000ff;
-      tricore_mask_rrr =  0x00f000ff;
-      tricore_mask_rrr1 = 0x00fc00ff;
-      tricore_mask_rrr2 = 0x00ff00ff;
-      tricore_mask_rrrr = 0x00e000ff;
-      tricore_mask_rrrw = 0x00e000ff;
-      tricore_mask_sys =  0x07c000ff;
-      tricore_mask_sb =       0x00ff;
-      tricore_mask_sbc =      0x00ff;
-      tricore_mask_sbr =      0x00ff;
-      tricore_mask_sbrn =     0x007f;
-      tricore_mask_sc =       0x00ff;
-      tricore_mask_slr =      0x00ff;
-      tricore_mask_slro =     0x00ff;
-      tricore_mask_sr =       0xf0ff;
-      tricore_mask_src =      0x00ff;
-      tricore_mask_sro =      0x00ff;
-      tricore_mask_srr =      0x00ff;
-      tricore_mask_srrs =     0x003f;
-      tricore_mask_ssr =      0x00ff;
-      tricore_mask_ssro =     0x00ff;
-      break;
+      opmask[TRICORE_FMT_ABS] = 0x0c0000ff;
+      opmask[TRICORE_FMT_ABSB] = 0x0c0000ff;
+      opmask[TRICORE_FMT_B] = 0x000000ff;
+      opmask[TRICORE_FMT_BIT] = 0x006000ff;
+      opmask[TRICORE_FMT_BO] = 0x0fc000ff;
+      opmask[TRICORE_FMT_BOL] = 0x000000ff;
+      opmask[TRICORE_FMT_BRC] = 0x800000ff;
+      opmask[TRICORE_FMT_BRN] = 0x8000007f;
+      opmask[TRICORE_FMT_BRR] = 0x800000ff;
+      opmask[TRICORE_FMT_RC] = 0x0fe000ff;
+      opmask[TRICORE_FMT_RCPW] = 0x006000ff;
+      opmask[TRICORE_FMT_RCR] = 0x00e000ff;
+      opmask[TRICORE_FMT_RCRR] = 0x00e000ff;
+      opmask[TRICORE_FMT_RCRW] = 0x00e000ff;
+      opmask[TRICORE_FMT_RLC] = 0x000000ff;
+      opmask[TRICORE_FMT_RR] = 0x0ff000ff;
+      opmask[TRICORE_FMT_RRPW] = 0x006000ff;
+      opmask[TRICORE_FMT_RRR] = 0x00f000ff;
+      opmask[TRICORE_FMT_RRR1] = 0x00fc00ff;
+      opmask[TRICORE_FMT_RRR2] = 0x00ff00ff;
+      opmask[TRICORE_FMT_RRRR] = 0x00e000ff;
+      opmask[TRICORE_FMT_RRRW] = 0x00e000ff;
+      opmask[TRICORE_FMT_SYS] = 0x07c000ff;
+      opmask[TRICORE_FMT_SB] = 0x00ff;
+      opmask[TRICORE_FMT_SBC] = 0x00ff;
+      opmask[TRICORE_FMT_SBR] = 0x00ff;
+      opmask[TRICORE_FMT_SBRN] = 0x007f;
+      opmask[TRICORE_FMT_SC] = 0x00ff;
+      opmask[TRICORE_FMT_SLR] = 0x00ff;
+      opmask[TRICORE_FMT_SLRO] = 0x00ff;
+      opmask[TRICORE_FMT_SR] = 0xf0ff;
+      opmask[TRICORE_FMT_SRC] = 0x00ff;
+      opmask[TRICORE_FMT_SRO] = 0x00ff;
+      opmask[TRICORE_FMT_SRR] = 0x00ff;
+      opmask[TRICORE_FMT_SRRS] = 0x003f;
+      opmask[TRICORE_FMT_SSR] = 0x00ff;
+      opmask[TRICORE_FMT_SSRO] = 0x00ff;
+      return 1;
 
     case EF_EABI_TRICORE_V1_2: 
     case EF_EABI_TRICORE_V1_3: 
@@ -282,89 +281,106 @@ tricore_init_arch_vars (mach)
     case EF_EABI_TRICORE_V1_6_1:
     case EF_EABI_TRICORE_V1_6_2:
     case EF_EABI_TRICORE_V1_8:
-      tricore_mask_abs =  0x0c0000ff;
-      tricore_mask_absb = 0x0c0000ff;
-      tricore_mask_b =    0x000000ff;
-      tricore_mask_bit =  0x006000ff;
-      tricore_mask_bo =   0x0fc000ff;
-      tricore_mask_bol =  0x000000ff;
-      tricore_mask_brc =  0x800000ff;
-      tricore_mask_brn =  0x8000007f;
-      tricore_mask_brr =  0x800000ff;
-      tricore_mask_rc =   0x0fe000ff;
-      tricore_mask_rcpw = 0x006000ff;
-      tricore_mask_rcr =  0x00e000ff;
-      tricore_mask_rcrr = 0x00e000ff;
-      tricore_mask_rcrw = 0x00e000ff;
-      tricore_mask_rlc =  0x000000ff;
-      tricore_mask_rr =   0x0ff300ff;
-      tricore_mask_rr1 =  0x0ffc00ff; 
-      tricore_mask_rr2 =  0x0fff00ff;
-      tricore_mask_rrpw = 0x006000ff;
-      tricore_mask_rrr =  0x00f300ff;
-      tricore_mask_rrr1 = 0x00fc00ff;
-      tricore_mask_rrr2 = 0x00ff00ff;
-      tricore_mask_rrrr = 0x00e000ff;
-      tricore_mask_rrrw = 0x00e000ff;
-      tricore_mask_sys =  0x0fc000ff;
-      tricore_mask_sb =       0x00ff;
-      tricore_mask_sbc =      0x00ff;
-      tricore_mask_sbr =      0x00ff;
-      tricore_mask_sbrn =     0x00ff;
-      tricore_mask_sc =       0x00ff;
-      tricore_mask_slr =      0x00ff;
-      tricore_mask_slro =     0x00ff;
-      tricore_mask_sr =       0xf0ff;
-      tricore_mask_src =      0x00ff;
-      tricore_mask_sro =      0x00ff;
-      tricore_mask_srr =      0x00ff;
-      tricore_mask_srrs =     0x003f;
-      tricore_mask_ssr =      0x00ff;
-      tricore_mask_ssro =     0x00ff;
-      break;
+      opmask[TRICORE_FMT_ABS] = 0x0c0000ff;
+      opmask[TRICORE_FMT_ABSB] = 0x0c0000ff;
+      opmask[TRICORE_FMT_B] = 0x000000ff;
+      opmask[TRICORE_FMT_BIT] = 0x006000ff;
+      opmask[TRICORE_FMT_BO] = 0x0fc000ff;
+      opmask[TRICORE_FMT_BOL] = 0x000000ff;
+      opmask[TRICORE_FMT_BRC] = 0x800000ff;
+      opmask[TRICORE_FMT_BRN] = 0x8000007f;
+      opmask[TRICORE_FMT_BRR] = 0x800000ff;
+      opmask[TRICORE_FMT_RC] = 0x0fe000ff;
+      opmask[TRICORE_FMT_RCPW] = 0x006000ff;
+      opmask[TRICORE_FMT_RCR] = 0x00e000ff;
+      opmask[TRICORE_FMT_RCRR] = 0x00e000ff;
+      opmask[TRICORE_FMT_RCRW] = 0x00e000ff;
+      opmask[TRICORE_FMT_RLC] = 0x000000ff;
+      opmask[TRICORE_FMT_RR] = 0x0ff300ff;
+      opmask[TRICORE_FMT_RR1] = 0x0ffc00ff; 
+      opmask[TRICORE_FMT_RR2] = 0x0fff00ff;
+      opmask[TRICORE_FMT_RRPW] = 0x006000ff;
+      opmask[TRICORE_FMT_RRR] = 0x00f300ff;
+      opmask[TRICORE_FMT_RRR1] = 0x00fc00ff;
+      opmask[TRICORE_FMT_RRR2] = 0x00ff00ff;
+      opmask[TRICORE_FMT_RRRR] = 0x00e000ff;
+      opmask[TRICORE_FMT_RRRW] = 0x00e000ff;
+      opmask[TRICORE_FMT_SYS] = 0x0fc000ff;
+      opmask[TRICORE_FMT_SB] = 0x00ff;
+      opmask[TRICORE_FMT_SBC] = 0x00ff;
+      opmask[TRICORE_FMT_SBR] = 0x00ff;
+      opmask[TRICORE_FMT_SBRN] = 0x00ff;
+      opmask[TRICORE_FMT_SC] = 0x00ff;
+      opmask[TRICORE_FMT_SLR] = 0x00ff;
+      opmask[TRICORE_FMT_SLRO] = 0x00ff;
+      opmask[TRICORE_FMT_SR] = 0xf0ff;
+      opmask[TRICORE_FMT_SRC] = 0x00ff;
+      opmask[TRICORE_FMT_SRO] = 0x00ff;
+      opmask[TRICORE_FMT_SRR] = 0x00ff;
+      opmask[TRICORE_FMT_SRRS] = 0x003f;
+      opmask[TRICORE_FMT_SSR] = 0x00ff;
+      opmask[TRICORE_FMT_SSRO] = 0x00ff;
+      return 1;
     }
 
-  /* Now fill in tricore_opmask[].  */
+  return 0;
+
+}
+
+/* Initialize the architecture-specific variables.  This must be called
+   by the assembler prior to encoding any TriCore instructions;  the
+   linker (or more precisely, the specific back-end,
+   bfd/elf32-tricore.c:tricore_elf32_relocate_section) will also have
+   to call this if it ever accesses the variables below, but it
+   currently doesn't.  The disassembler uses tricore_get_opmask.  */
+
+void
+tricore_init_arch_vars (mach)
+     unsigned long mach;
+{
+  tricore_get_opmask (mach, tricore_opmask);
+
+  /* Now set the per-format variables.  */
 
-  tricore_opmask[TRICORE_FMT_ABS] = tricore_mask_abs;
-  tricore_opmask[TRICORE_FMT_ABSB] = tricore_mask_absb;
-  tricore_opmask[TRICORE_FMT_B] = tricore_mask_b;
-  tricore_opmask[TRICORE_FMT_BIT] = tricore_mask_bit;
-  tricore_opmask[TRICORE_FMT_BO] = tricore_mask_bo;
-  tricore_opmask[TRICORE_FMT_BOL] = tricore_mask_bol;
-  tricore_opmask[TRICORE_FMT_BRC] = tricore_mask_brc;
-  tricore_opmask[TRICORE_FMT_BRN] = tricore_mask_brn;
-  tricore_opmask[TRICORE_FMT_BRR] = tricore_mask_brr;
-  tricore_opmask[TRICORE_FMT_RC] = tricore_mask_rc;
-  tricore_opmask[TRICORE_FMT_RCPW] = tricore_mask_rcpw;
-  tricore_opmask[TRICORE_FMT_RCR] = tricore_mask_rcr;
-  tricore_opmask[TRICORE_FMT_RCRR] = tricore_mask_rcrr;
-  tricore_opmask[TRICORE_FMT_RCRW] = tricore_mask_rcrw;
-  tricore_opmask[TRICORE_FMT_RLC] = tricore_mask_rlc;
-  tricore_opmask[TRICORE_FMT_RR] = tricore_mask_rr;
-  tricore_opmask[TRICORE_FMT_RR1] = tricore_mask_rr1; 
-  tricore_opmask[TRICORE_FMT_RR2] = tricore_mask_rr2;
-  tricore_opmask[TRICORE_FMT_RRPW] = tricore_mask_rrpw;
-  tricore_opmask[TRICORE_FMT_RRR] = tricore_mask_rrr;
-  tricore_opmask[TRICORE_FMT_RRR1] = tricore_mask_rrr1;
-  tricore_opmask[TRICORE_FMT_RRR2] = tricore_mask_rrr2;
-  tricore_opmask[TRICORE_FMT_RRRR] = tricore_mask_rrrr;
-  tricore_opmask[TRICORE_FMT_RRRW] = tricore_mask_rrrw;
-  tricore_opmask[TRICORE_FMT_SYS] = tricore_mask_sys;
-  tricore_opmask[TRICORE_FMT_SB] = tricore_mask_sb;
-  tricore_opmask[TRICORE_FMT_SBC] = tricore_mask_sbc;
-  tricore_opmask[TRICORE_FMT_SBR] = tricore_mask_sbr;
-  tricore_opmask[TRICORE_FMT_SBRN] = tricore_mask_sbrn;
-  tricore_opmask[TRICORE_FMT_SC] = tricore_mask_sc;
-  tricore_opmask[TRICORE_FMT_SLR] = tricore_mask_slr;
-  tricore_opmask[TRICORE_FMT_SLRO] = tricore_mask_slro;
-  tricore_opmask[TRICORE_FMT_SR] = tricore_mask_sr;
-  tricore_opmask[TRICORE_FMT_SRC] = tricore_mask_src;
-  tricore_opmask[TRICORE_FMT_SRO] = tricore_mask_sro;
-  tricore_opmask[TRICORE_FMT_SRR] = tricore_mask_srr;
-  tricore_opmask[TRICORE_FMT_SRRS] = tricore_mask_srrs;
-  tricore_opmask[TRICORE_FMT_SSR] = tricore_mask_ssr;
-  tricore_opmask[TRICORE_FMT_SSRO] = tricore_mask_ssro;
+  tricore_mask_abs = tricore_opmask[TRICORE_FMT_ABS];
+  tricore_mask_absb = tricore_opmask[TRICORE_FMT_ABSB];
+  tricore_mask_b = tricore_opmask[TRICORE_FMT_B];
+  tricore_mask_bit = tricore_opmask[TRICORE_FMT_BIT];
+  tricore_mask_bo = tricore_opmask[TRICORE_FMT_BO];
+  tricore_mask_bol = tricore_opmask[TRICORE_FMT_BOL];
+  tricore_mask_brc = tricore_opmask[TRICORE_FMT_BRC];
+  tricore_mask_brn = tricore_opmask[TRICORE_FMT_BRN];
+  tricore_mask_brr = tricore_opmask[TRICORE_FMT_BRR];
+  tricore_mask_rc = tricore_opmask[TRICORE_FMT_RC];
+  tricore_mask_rcpw = tricore_opmask[TRICORE_FMT_RCPW];
+  tricore_mask_rcr = tricore_opmask[TRICORE_FMT_RCR];
+  tricore_mask_rcrr = tricore_opmask[TRICORE_FMT_RCRR];
+  tricore_mask_rcrw = tricore_opmask[TRICORE_FMT_RCRW];
+  tricore_mask_rlc = tricore_opmask[TRICORE_FMT_RLC];
+  tricore_mask_rr = tricore_opmask[TRICORE_FMT_RR];
+  tricore_mask_rr1 = tricore_opmask[TRICORE_FMT_RR1]; 
+  tricore_mask_rr2 = tricore_opmask[TRICORE_FMT_RR2];
+  tricore_mask_rrpw = tricore_opmask[TRICORE_FMT_RRPW];
+  tricore_mask_rrr = tricore_opmask[TRICORE_FMT_RRR];
+  tricore_mask_rrr1 = tricore_opmask[TRICORE_FMT_RRR1];
+  tricore_mask_rrr2 = tricore_opmask[TRICORE_FMT_RRR2];
+  tricore_mask_rrrr = tricore_opmask[TRICORE_FMT_RRRR];
+  tricore_mask_rrrw = tricore_opmask[TRICORE_FMT_RRRW];
+  tricore_mask_sys = tricore_opmask[TRICORE_FMT_SYS];
+  tricore_mask_sb = tricore_opmask[TRICORE_FMT_SB];
+  tricore_mask_sbc = tricore_opmask[TRICORE_FMT_SBC];
+  tricore_mask_sbr = tricore_opmask[TRICORE_FMT_SBR];
+  tricore_mask_sbrn = tricore_opmask[TRICORE_FMT_SBRN];
+  tricore_mask_sc = tricore_opmask[TRICORE_FMT_SC];
+  tricore_mask_slr = tricore_opmask[TRICORE_FMT_SLR];
+  tricore_mask_slro = tricore_opmask[TRICORE_FMT_SLRO];
+  tricore_mask_sr = tricore_opmask[TRICORE_FMT_SR];
+  tricore_mask_src = tricore_opmask[TRICORE_FMT_SRC];
+  tricore_mask_sro = tricore_opmask[TRICORE_FMT_SRO];
+  tricore_mask_srr = tricore_opmask[TRICORE_FMT_SRR];
+  tricore_mask_srrs = tricore_opmask[TRICORE_FMT_SRRS];
+  tricore_mask_ssr = tricore_opmask[TRICORE_FMT_SSR];
+  tricore_mask_ssro = tricore_opmask[TRICORE_FMT_SSRO];
 }
 
 /* End of cpu-tricore.c.  */
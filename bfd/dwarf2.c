@@ -674,7 +674,8 @@ lookup_info_hash_table (struct info_hash_table *hash_table, const char *key)
 /* Read a section into its appropriate place in the dwarf2_debug
    struct (indicated by SECTION_BUFFER and SECTION_SIZE).  If SYMS is
    not NULL, use bfd_simple_get_relocated_section_contents to read the
-   section contents, otherwise use bfd_get_section_contents.  Fail if
+   section contents, otherwise use bfd_get_section_contents_view, in
+   which case the buffer may point into the mapped file.  Fail if
    the located section does not contain at least OFFSET bytes.  */
 
 static bool
@@ -734,19 +735,46 @@ read_section (bfd *abfd,
 	  bfd_set_error (bfd_error_no_memory);
 	  return false;
 	}
-      contents = (bfd_byte *) bfd_malloc (amt);
-      if (contents == NULL)
-	return false;
-      if (syms
-	  ? !bfd_simple_get_relocated_section_contents (abfd, msec, contents,
-							syms)
-	  : !bfd_get_section_contents (abfd, msec, contents, 0, *section_size))
+      if (syms == NULL)
 	{
-	  free (contents);
-	  return false;
+	  bfd_byte *view = NULL;
+
+	  if (!bfd_get_section_contents_view (abfd, msec, &view))
+	    return false;
+	  if (!_bfd_file_view_contains (abfd, view))
+	    contents = (bfd_byte *) bfd_realloc_or_free (view, amt);
+	  else if (view[*section_size - 1] == 0)
+	    {
+	      /* Already NUL terminated, so the mapped file will do.  */
+	      *section_buffer = view;
+	      contents = NULL;
+	    }
+	  else
+	    {
+	      contents = (bfd_byte *) bfd_malloc (amt);
+	      if (contents != NULL)
+		memcpy (contents, view, *section_size);
+	    }
+	  if (contents == NULL && *section_buffer == NULL)
+	    return false;
+	}
+      else
+	{
+	  contents = (bfd_byte *) bfd_malloc (amt);
+	  if (contents == NULL)
+	    return false;
+	  if (!bfd_simple_get_relocated_section_contents (abfd, msec,
+							  contents, syms))
+	    {
+	      free (contents);
+	      return false;
+	    }
+	}
+      if (contents != NULL)
+	{
+	  contents[*section_size] = 0;
+	  *section_buffer = contents;
 	}
-      contents[*section_size] = 0;
-      *section_buffer = contents;
     }
 
   /* It is possible to get a bad value for the offset into the section
@@ -6120,12 +6148,17 @@ _bfd_dwarf2_cleanup_debug_info (bfd *abfd, void **pinfo)
       if (file->comp_unit_tree != NULL)
 	splay_tree_delete (file->comp_unit_tree);
 
-      free (file->dwarf_line_str_buffer);
-      free (file->dwarf_str_buffer);
-      free (file->dwarf_ranges_buffer);
-      free (file->dwarf_line_buffer);
-      free (file->dwarf_abbrev_buffer);
-      free (file->dwarf_info_buffer);
+      if (file->bfd_ptr != NULL)
+	{
+	  bfd *fbfd = file->bfd_ptr;
+
+	  bfd_release_section_contents_view (fbfd, file->dwarf_line_str_buffer);
+	  bfd_release_section_contents_view (fbfd, file->dwarf_str_buffer);
+	  bfd_release_section_contents_view (fbfd, file->dwarf_ranges_buffer);
+	  bfd_release_section_contents_view (fbfd, file->dwarf_line_buffer);
+	  bfd_release_section_contents_view (fbfd, file->dwarf_abbrev_buffer);
+	  bfd_release_section_contents_view (fbfd, file->dwarf_info_buffer);
+	}
       if (file == &stash->alt)
 	break;
       file = &stash->alt;
@@ -697,6 +697,13 @@ struct elf_link_hash_table
   /* A pointer to information used to merge SEC_MERGE sections.  */
   void *merge_info;
 
+  /* Sections queued by _bfd_elf_gc_mark whose relocs have not been
+     scanned yet, and whether the queue is being drained.  */
+  struct elf_gc_mark_entry *gc_mark_stack;
+  size_t gc_mark_count;
+  size_t gc_mark_alloc;
+  bool gc_marking;
+
   /* Used to link stabs in sections.  */
   struct stab_info stab_info;
 
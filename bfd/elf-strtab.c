@@ -339,15 +339,13 @@ _bfd_elf_strtab_emit (register bfd *abfd, struct elf_strtab_hash *tab)
   return true;
 }
 
-/* Compare two elf_strtab_hash_entry structures.  Called via qsort.
-   Won't ever return zero as all entries differ, so there is no issue
-   with qsort stability here.  */
+/* Compare two elf_strtab_hash_entry structures by their reversed
+   strings.  Won't ever return zero as all entries differ.  */
 
 static int
-strrevcmp (const void *a, const void *b)
+strrevcmp (const struct elf_strtab_hash_entry *A,
+	   const struct elf_strtab_hash_entry *B)
 {
-  struct elf_strtab_hash_entry *A = *(struct elf_strtab_hash_entry **) a;
-  struct elf_strtab_hash_entry *B = *(struct elf_strtab_hash_entry **) b;
   unsigned int lenA = A->len;
   unsigned int lenB = B->len;
   const unsigned char *s = (const unsigned char *) A->root.string + lenA - 1;
@@ -365,6 +363,117 @@ strrevcmp (const void *a, const void *b)
   return lenA - lenB;
 }
 
+/* Return the character DEPTH places back from the end of the string
+   of E, or zero once DEPTH reaches its start.  Strings in the table
+   don't contain zero bytes, so ordering by these characters at
+   increasing depth is the same as ordering with strrevcmp.  */
+
+static inline int
+strrev_char (const struct elf_strtab_hash_entry *e, unsigned int depth)
+{
+  if (depth >= (unsigned int) e->len)
+    return 0;
+  return ((const unsigned char *) e->root.string)[e->len - 1 - depth];
+}
+
+/* Partitions smaller than this are insertion sorted.  */
+#define STRREV_INSERTION_SORT 16
+
+/* Sort the N entries at A into strrevcmp order, given that they are
+   known to agree in their last DEPTH characters.  This is a multikey
+   quicksort (Bentley and Sedgewick) on the reversed strings: each
+   character is looked at about once per entry rather than once per
+   comparison, which matters for the long common suffixes of mangled
+   C++ names.  */
+
+static void
+strrev_sort (struct elf_strtab_hash_entry **a, size_t n, unsigned int depth)
+{
+  while (n > 1)
+    {
+      struct elf_strtab_hash_entry *t;
+      size_t lt, gt, i, neq, ngt;
+      int c0, c1, c2, v;
+
+      if (n < STRREV_INSERTION_SORT)
+	{
+	  for (i = 1; i < n; i++)
+	    {
+	      size_t j;
+
+	      t = a[i];
+	      for (j = i; j > 0 && strrevcmp (a[j - 1], t) > 0; j--)
+		a[j] = a[j - 1];
+	      a[j] = t;
+	    }
+	  return;
+	}
+
+      /* Median of three for the pivot character.  */
+      c0 = strrev_char (a[0], depth);
+      c1 = strrev_char (a[n / 2], depth);
+      c2 = strrev_char (a[n - 1], depth);
+      if (c0 > c1)
+	{
+	  v = c0;
+	  c0 = c1;
+	  c1 = v;
+	}
+      v = c2 < c0 ? c0 : c2 > c1 ? c1 : c2;
+
+      /* Partition into [0,lt) less than V, [lt,gt) equal to V and
+	 [gt,n) greater than V at this depth.  */
+      lt = i = 0;
+      gt = n;
+      while (i < gt)
+	{
+	  int c = strrev_char (a[i], depth);
+
+	  if (c < v)
+	    {
+	      t = a[lt];
+	      a[lt++] = a[i];
+	      a[i++] = t;
+	    }
+	  else if (c > v)
+	    {
+	      t = a[--gt];
+	      a[gt] = a[i];
+	      a[i] = t;
+	    }
+	  else
+	    i++;
+	}
+
+      /* Recurse on the two smaller partitions and loop on the largest,
+	 to keep the stack shallow.  Entries equal to a zero V have all
+	 ended, and there can only be one of those.  */
+      neq = v == 0 ? 0 : gt - lt;
+      ngt = n - gt;
+      if (lt >= neq && lt >= ngt)
+	{
+	  strrev_sort (a + lt, neq, depth + 1);
+	  strrev_sort (a + gt, ngt, depth);
+	  n = lt;
+	}
+      else if (neq >= ngt)
+	{
+	  strrev_sort (a, lt, depth);
+	  strrev_sort (a + gt, ngt, depth);
+	  a += lt;
+	  n = neq;
+	  depth++;
+	}
+      else
+	{
+	  strrev_sort (a, lt, depth);
+	  strrev_sort (a + lt, neq, depth + 1);
+	  a += gt;
+	  n = ngt;
+	}
+    }
+}
+
 static inline int
 is_suffix (const struct elf_strtab_hash_entry *A,
 	   const struct elf_strtab_hash_entry *B)
@@ -411,7 +520,7 @@ _bfd_elf_strtab_finalize (struct elf_strtab_hash *tab)
   size = a - array;
   if (size != 0)
     {
-      qsort (array, size, sizeof (struct elf_strtab_hash_entry *), strrevcmp);
+      strrev_sort (array, size, 0);
 
       /* Loop over the sorted array and merge suffixes.  Start from the
 	 end because we want eg.
@@ -27,6 +27,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.  */
 #include "bfdlink.h"
 #include "genlink.h" 
 #include "libiberty.h"
+#include "objalloc.h"
 #include "elf-bfd.h"
 #include "elf/tricore.h"
 #include "elf/elf32-tricore-disass.h"
@@ -1640,6 +1641,10 @@ bool tricore_elf32_callinfo_report = false;
 
 int tricore_relax_before_alloc = 0;
 
+/* True if linker statistics were requested (ld --stats).  */
+
+bool tricore_elf32_stats = false;
+
 #if 0
 // PCP support is discontinued
 
@@ -1667,6 +1672,8 @@ typedef struct tricore_user_section_struct {
   const flagword region_flags;
 } tricore_section_userdata_type;
 
+#define NUM_CORES    8
+
 /* mapping core specific memory region to alternate global addresses */
 typedef struct _memmap {
   struct _memmap *next;
@@ -1676,9 +1683,24 @@ typedef struct _memmap {
   bfd_vma       alt_origin;
 } memmap_t;
 
-#define CALLINFO_LEN_MAX 0x2000
+/* Per-core index of the region maps.  Where mappings of one core
+   overlap, the most recently declared one is in effect, so the index
+   holds the disjoint pieces of the mappings that are not shadowed by
+   a newer one, sorted by address.  The index is built before the first
+   input section is relocated, so that address queries issued while
+   relocating are answered by a binary search instead of a list walk.  */
+typedef struct _memmap_piece {
+  bfd_vma start;
+  bfd_vma end;
+  memmap_t *map;
+} memmap_piece_t;
 
-struct bfd_link_info *tricore_info;
+typedef struct _memmap_index {
+  memmap_piece_t *pieces;
+  unsigned int count;
+} memmap_index_t;
+
+#define CALLINFO_LEN_MAX 0x2000
 
 typedef struct callinfo
 {
@@ -1698,11 +1720,159 @@ typedef struct callinfo
   int done; // 2 after correct initial entry, 3 if regs analysis is completed
   bfd *abfd;
   struct bfd_link_info *info;
+  int blocked_by; // callee whose analysis is still pending
+  int waiters; // first function blocked by this one, -1 if none
+  int next_waiter; // next function blocked by the same callee
+  asection *fcall_stop_sec; // section in which call->fcall failed
 } callinfo_t;
 
-callinfo_t *callinfo;
-int callinfo_len;
-int callinfo_len_limit;
+/* Key of the callinfo index, sorted by function start address.  */
+typedef struct callinfo_key
+{
+  bfd_vma addrbeg;
+  int idx;
+} callinfo_key_t;
+
+/* A call/jump stub appended to an input section by
+   tricore_elf32_relax_pcrel.  */
+typedef struct pcrel_stub
+{
+  bfd_vma offset;
+  bfd_vma addend;
+  unsigned long symoff;
+  int size;
+} pcrel_stub_t;
+
+typedef struct pcrel_stubs
+{
+  pcrel_stub_t *stubs;
+  int num;                /* index of the last stub, -1 if there is none */
+  int max;
+  bool relocs_malloced;   /* relocs have been copied to malloc()ed memory */
+} pcrel_stubs_t;
+
+/* A bit object together with the symbol "name.pos" that holds its bit
+   position.  For a local bit object, SYM and POS are local symbol
+   indices (POS is -1 if there's no such symbol) and FILE is the name
+   of the STT_FILE symbol preceding it, if any; for a global one, H and
+   POS_H are the hash entries, and POS is the symbol index of POS_H in
+   the defining object, or -1 if it isn't defined there.  */
+typedef struct bit_object
+{
+  unsigned long sym;
+  unsigned long pos;
+  const char *file;
+  struct elf_link_hash_entry *h;
+  struct elf_link_hash_entry *pos_h;
+} bit_object_t;
+
+/* A relocation against the section symbol of a bit section.  ADDEND is
+   its original addend, by which the relocs of a section are sorted;
+   BITPOS is the R_TRICORE_BITPOS reloc immediately preceding it (if
+   any, and if it has the same addend), ORDER its position among all
+   relocs of the object, and ADJUSTED tells whether it has already been
+   changed by tricore_elf32_adjust_bit_relocs.  */
+typedef struct bit_reloc
+{
+  Elf_Internal_Rela *irel;
+  Elf_Internal_Rela *bitpos;
+  asection *sec;
+  bfd_vma addend;
+  unsigned int order;
+  bool adjusted;
+} bit_reloc_t;
+
+/* Bit objects of a bit section (.b{data,bss}{,.*}), in symbol table
+   order, and the relocs referencing them.  */
+typedef struct bit_section
+{
+  asection *sec;
+  unsigned int shndx;
+  bit_object_t *locals;
+  unsigned int num_locals;
+  bit_object_t *globals;
+  unsigned int num_globals;
+  bit_reloc_t *relocs;
+  unsigned int num_relocs;
+  bool relocs_indexed;
+} bit_section_t;
+
+/* State of the relaxation passes of one link.  It hangs off the TriCore
+   linker hash table, so that several links done by one process share
+   nothing, and it is released at the end of tricore_elf32_final_link.  */
+struct tricore_relax_context
+{
+  /* Arena for the tables whose size is known when they are created.  */
+  struct objalloc *memory;
+
+  /* Functions described in the .callinfo sections.  */
+  callinfo_t *callinfo;
+  int callinfo_len;
+  int callinfo_len_limit;
+  callinfo_key_t *callinfo_sorted;
+  bool init_done;
+  bool stat_callinfo;
+  bool fcallfret_callinfo;
+
+  /* Time spent in the phases of the fcall/fret optimization (--callinfo).  */
+  long time_init;
+  long time_regs;
+  long time_status;
+  long time_fcallfret;
+  unsigned long regs_visits;
+
+  /* Stubs created by tricore_elf32_relax_pcrel, indexed by section id.  */
+  pcrel_stubs_t *pcrel;
+  unsigned int num_pcrel;
+
+  /* Index of the bit sections, by section id; see tricore_elf32_bit_index.  */
+  bit_section_t **bit_sections;
+  unsigned int num_bit_sections;
+};
+
+/* TriCore ELF linker hash table.  */
+struct tricore_elf32_link_hash_table
+{
+  struct elf_link_hash_table elf;
+  struct tricore_relax_context relax;
+
+  /* Set once tricore_elf32_relocate_section has determined the final
+     values of "_GLOBAL_OFFSET_TABLE_" and of the SDA base symbols.  */
+  bool final_got;
+  bool final_sda_bases;
+
+  /* Index of the region maps, and the head of the region map list it
+     was built from; see tricore_elf32_memory_map_build_index.  */
+  memmap_index_t region_index[NUM_CORES];
+  memmap_t *region_index_head;
+  bool region_index_valid;
+
+  /* Number of region maps indexed, and of lookups done on the index;
+     reported with --stats.  */
+  unsigned int region_map_count;
+  unsigned long region_map_lookups;
+
+  /* Symbols exported with their export names, and the __caller. and
+     __callee. symbols checked by tricore_elf32_check_caller_callee.
+     These only use the symbol lookup part of an ELF hash table.  */
+  struct elf_link_hash_table export_hash;
+  struct elf_link_hash_table caller_hash;
+  struct elf_link_hash_table callee_hash;
+};
+
+/* Get the TriCore ELF linker hash table from a link_info structure.  */
+#define tricore_elf32_hash_table(p) \
+  ((is_elf_hash_table ((p)->hash)					\
+    && elf_hash_table_id (elf_hash_table (p)) == TRICORE_ELF_DATA)	\
+   ? (struct tricore_elf32_link_hash_table *) (p)->hash : NULL)
+
+static struct tricore_relax_context *
+tricore_elf32_relax_ctx (struct bfd_link_info *info)
+{
+  struct tricore_elf32_link_hash_table *htab = tricore_elf32_hash_table (info);
+
+  return (htab != NULL) ? &htab->relax : NULL;
+}
 
 /* Instructions */
 #define DISASM_CONDBRANCH     0x00000001
@@ -1801,13 +1971,22 @@ int tricore_elf32_check_core_name(const char *);
 
 void tricore_elf32_set_core_alias (const char *, const char *);
 
-static memmap_t * tricore_elf32_memory_map_lookup(bfd_vma, unsigned int);
+static bool tricore_elf32_memory_map_build_index
+    (struct tricore_elf32_link_hash_table *);
+
+static void tricore_elf32_memory_map_free_index
+    (struct tricore_elf32_link_hash_table *);
+
+static memmap_t * tricore_elf32_memory_map_lookup
+    (struct tricore_elf32_link_hash_table *, bfd_vma, unsigned int);
 
 void tricore_elf32_add_memory_map
     (unsigned int, bfd_vma, bfd_size_type, bfd_vma);
 
 void print_region_maps(FILE *out);
 
+void tricore_elf32_print_memory_map_stats (struct bfd_link_info *, FILE *);
+
 void tricore_elf32_add_exported_symbol
     (const char *, bool, bfd_size_type, const char *);
 
@@ -1816,11 +1995,19 @@ void tricore_elf32_do_export_symbols(struct bfd_link_info *);
 static bool tricore_elf32_export_add_sym(struct bfd_link_hash_entry *, void *);
 
 static bfd_vma tricore_elf32_get_alternate_address
-    (bfd_vma, unsigned int, asection *, asection *);
+    (struct tricore_elf32_link_hash_table *, bfd_vma, unsigned int,
+     asection *, asection *);
+
+static bool tricore_elf32_add_call_symbol
+  (struct tricore_elf32_link_hash_table *, const char *);
 
-static void tricore_elf32_add_call_symbol(const char *);
+static bool tricore_elf32_call_symbol_hash_create
+  (struct tricore_elf32_link_hash_table *);
 
-static bool tricore_elf32_call_symbol_hash_create(bfd *);
+static bool tricore_elf32_free_call_symbol
+  (struct bfd_link_hash_entry *, void *);
+
+static void tricore_elf32_link_hash_table_free (bfd *);
 
 static reloc_howto_type *tricore_elf_reloc_name_lookup (bfd *, const char *);
 
@@ -1866,13 +2053,12 @@ static unsigned long tricore_elf32_get_bitpos
              struct elf_link_hash_entry **, asection *, bool *);
 
 static bool tricore_elf32_adjust_bit_relocs
-     (bfd *, struct bfd_link_info *, unsigned long,
-             bfd_vma, bfd_vma, int, unsigned int);
+     (bit_section_t *, bfd_vma, bfd_vma, int, unsigned long);
 
 static bool tricore_elf32_relax_section
      (bfd *, asection *, struct bfd_link_info *, bool *);
 
-void tricore_elf32_list_bit_objects (struct bfd_link_info *,FILE *);
+bool tricore_elf32_list_bit_objects (struct bfd_link_info *,FILE *);
 
 static enum elf_reloc_type_class tricore_elf32_reloc_type_class
      (const struct bfd_link_info *, const asection *, const Elf_Internal_Rela *);
@@ -1909,8 +2095,6 @@ tricore_elf_reloc_name_lookup (bfd *abfd ATTRIBUTE_UNUSED,
 
 /* Core handling data structures and functions */
 
-#define NUM_CORES    8
-
 static char *tricore_core_names[NUM_CORES] = {
     "GLOBAL",
     "CPU0",
@@ -2067,23 +2251,266 @@ tricore_elf32_set_core_alias (const char *alias, const char *name)
   (*_bfd_error_handler)(_("Warning: Core name %s not defined\n"), name);
 }
 
+/* Forget the core aliases declared for a link.  */
+static void
+tricore_elf32_free_core_aliases (void)
+{
+  int i;
+
+  for (i = 0; i < NUM_CORES; i++)
+    {
+      free (tricore_core_aliases[i]);
+      tricore_core_aliases[i] = NULL;
+    }
+}
+
 
 static memmap_t *tricore_region_map = NULL;
 
-/* lookup for a memory map returns NULL if no mapping exists */
-static memmap_t *
-tricore_elf32_memory_map_lookup(bfd_vma addr, unsigned int core)
+/* A region map together with its age; 0 is the most recent one.  */
+typedef struct _memmap_entry {
+  memmap_t *map;
+  unsigned int age;
+} memmap_entry_t;
+
+static int
+tricore_elf32_memory_map_compare (const void *a, const void *b)
+{
+  const memmap_entry_t *ea = (const memmap_entry_t *) a;
+  const memmap_entry_t *eb = (const memmap_entry_t *) b;
+
+  if (ea->map->origin < eb->map->origin)
+    return -1;
+  if (ea->map->origin > eb->map->origin)
+    return 1;
+  return 0;
+}
+
+static int
+tricore_elf32_memory_map_compare_vma (const void *a, const void *b)
+{
+  bfd_vma va = *(const bfd_vma *) a;
+  bfd_vma vb = *(const bfd_vma *) b;
+
+  if (va < vb)
+    return -1;
+  if (va > vb)
+    return 1;
+  return 0;
+}
+
+/* Sift the entry at position I of the binary min-heap HEAP of N
+   entries, ordered by age, down to its place.  */
+static void
+tricore_elf32_memory_map_sift_down (memmap_entry_t *heap, unsigned int n,
+				    unsigned int i)
+{
+  for (;;)
+    {
+      unsigned int c = 2 * i + 1;
+      memmap_entry_t tmp;
+
+      if (c >= n)
+	return;
+      if (c + 1 < n && heap[c + 1].age < heap[c].age)
+	c++;
+      if (heap[i].age <= heap[c].age)
+	return;
+      tmp = heap[i];
+      heap[i] = heap[c];
+      heap[c] = tmp;
+      i = c;
+    }
+}
+
+/* Build the index of core CORE from its N region maps in ENTRIES.
+   The addresses where a mapping starts or ends are swept in ascending
+   order, keeping the mappings that cover the current address in a heap
+   ordered by age; between two such addresses the newest mapping on the
+   heap is in effect.  Mappings whose end has been passed are removed
+   only when they reach the top of the heap.  This takes O(n log n).  */
+static bool
+tricore_elf32_memory_map_index_core (memmap_index_t *idx,
+				     memmap_entry_t *entries, unsigned int n)
+{
+  memmap_entry_t *heap;
+  bfd_vma *points;
+  unsigned int i, j, k, npoints, nheap;
+
+  qsort (entries, n, sizeof (*entries), tricore_elf32_memory_map_compare);
+  points = (bfd_vma *) bfd_malloc (2 * n * sizeof (bfd_vma));
+  heap = (memmap_entry_t *) bfd_malloc (n * sizeof (memmap_entry_t));
+  /* Each boundary starts at most one piece.  */
+  idx->pieces = (memmap_piece_t *) bfd_malloc (2 * n * sizeof (memmap_piece_t));
+  if (points == NULL || heap == NULL || idx->pieces == NULL)
+    {
+      free (points);
+      free (heap);
+      free (idx->pieces);
+      idx->pieces = NULL;
+      return false;
+    }
+
+  npoints = 0;
+  for (i = 0; i < n; i++)
+    {
+      points[npoints++] = entries[i].map->origin;
+      points[npoints++] = entries[i].map->origin + entries[i].map->length;
+    }
+  qsort (points, npoints, sizeof (bfd_vma),
+	 tricore_elf32_memory_map_compare_vma);
+
+  nheap = 0;
+  j = 0;
+  for (k = 0; k + 1 < npoints; k++)
+    {
+      bfd_vma start = points[k];
+      bfd_vma end = points[k + 1];
+      memmap_t *map;
+
+      if (start == end)
+	continue;
+      /* Push the mappings starting here.  */
+      for (; j < n && entries[j].map->origin <= start; j++)
+	{
+	  i = nheap++;
+	  heap[i] = entries[j];
+	  while (i > 0 && heap[(i - 1) / 2].age > heap[i].age)
+	    {
+	      memmap_entry_t tmp = heap[i];
+
+	      heap[i] = heap[(i - 1) / 2];
+	      heap[(i - 1) / 2] = tmp;
+	      i = (i - 1) / 2;
+	    }
+	}
+      /* Drop the newest mappings as long as they end before here.  */
+      while (nheap > 0
+	     && heap[0].map->origin + heap[0].map->length <= start)
+	{
+	  heap[0] = heap[--nheap];
+	  tricore_elf32_memory_map_sift_down (heap, nheap, 0);
+	}
+      if (nheap == 0)
+	continue;
+
+      map = heap[0].map;
+      if (idx->count > 0
+	  && idx->pieces[idx->count - 1].map == map
+	  && idx->pieces[idx->count - 1].end == start)
+	idx->pieces[idx->count - 1].end = end;
+      else
+	{
+	  idx->pieces[idx->count].start = start;
+	  idx->pieces[idx->count].end = end;
+	  idx->pieces[idx->count].map = map;
+	  idx->count++;
+	}
+    }
+
+  free (points);
+  free (heap);
+  return true;
+}
+
+/* Free the per-core region index of HTAB.  */
+static void
+tricore_elf32_memory_map_free_index (struct tricore_elf32_link_hash_table *htab)
+{
+  unsigned int core;
+
+  for (core = 0; core < NUM_CORES; core++)
+    {
+      free (htab->region_index[core].pieces);
+      htab->region_index[core].pieces = NULL;
+      htab->region_index[core].count = 0;
+    }
+  htab->region_index_valid = false;
+}
+
+/* Build the per-core region index of HTAB from the region maps declared
+   so far.  The maps are prepended to tricore_region_map as they are
+   declared, so the index is stale once the list has a new head.  */
+static bool
+tricore_elf32_memory_map_build_index (struct tricore_elf32_link_hash_table *htab)
 {
+  memmap_entry_t *entries;
   memmap_t *p;
-  p = tricore_region_map;
-  while (p)
+  unsigned int core, n, age;
+
+  tricore_elf32_memory_map_free_index (htab);
+  htab->region_map_count = 0;
+  for (p = tricore_region_map; p; p = p->next)
+    htab->region_map_count++;
+
+  entries = NULL;
+  if (htab->region_map_count != 0)
+    {
+      entries = (memmap_entry_t *) bfd_malloc (htab->region_map_count
+					       * sizeof (memmap_entry_t));
+      if (entries == NULL)
+	return false;
+    }
+
+  for (core = 0; core < NUM_CORES && entries != NULL; core++)
+    {
+      /* The list holds the most recently declared mapping first.  */
+      n = 0;
+      for (p = tricore_region_map, age = 0; p; p = p->next, age++)
+	if (p->core == core && p->length != 0)
+	  {
+	    entries[n].map = p;
+	    entries[n].age = age;
+	    n++;
+	  }
+      if (n != 0
+	  && !tricore_elf32_memory_map_index_core (&htab->region_index[core],
+						   entries, n))
+	{
+	  free (entries);
+	  tricore_elf32_memory_map_free_index (htab);
+	  bfd_set_error (bfd_error_no_memory);
+	  return false;
+	}
+    }
+
+  free (entries);
+  htab->region_index_head = tricore_region_map;
+  htab->region_index_valid = true;
+  return true;
+}
+
+/* lookup for a memory map returns NULL if no mapping exists; the index
+   must have been built by tricore_elf32_memory_map_build_index */
+static memmap_t *
+tricore_elf32_memory_map_lookup(struct tricore_elf32_link_hash_table *htab,
+				bfd_vma addr, unsigned int core)
+{
+  memmap_index_t *idx;
+  unsigned int lo, hi, mid;
+
+  BFD_ASSERT (htab->region_index_valid);
+  if (core >= NUM_CORES)
+    return NULL;
+
+  htab->region_map_lookups++;
+  idx = &htab->region_index[core];
+  lo = 0;
+  hi = idx->count;
+  /* Find the last piece that starts at or below ADDR.  */
+  while (lo < hi)
   {
-    if (((p->origin <= addr) && (addr < (p->origin + p->length)))
-        && (p->core == core))
-      return p;
-    p = p->next;
+    mid = lo + (hi - lo) / 2;
+    if (idx->pieces[mid].start <= addr)
+      lo = mid + 1;
+    else
+      hi = mid;
   }
-  return p;
+  if (lo == 0)
+    return NULL;
+  if (addr < idx->pieces[lo - 1].end)
+    return idx->pieces[lo - 1].map;
+  return NULL;
 }
 
 /* add a region map for a core */
@@ -2094,16 +2521,22 @@ tricore_elf32_add_memory_map(unsigned int core, bfd_vma origin,
   memmap_t *p;
   memmap_t *new_p;
 
-  p = tricore_elf32_memory_map_lookup(origin, core);
-  if (p != 0)
-  {
-    (*_bfd_error_handler)(
-        _("warning: memory region mapping for core %d of region 0x%lx already declared to 0x%lx\n"),
-        core,
-        p->origin,
-        p->alt_origin);
-  }
+  /* The mappings are only declared by the linker script, so walking
+     the list here is cheap.  */
+  for (p = tricore_region_map; p; p = p->next)
+    if (p->core == core
+	&& p->origin <= origin && origin < p->origin + p->length)
+    {
+      (*_bfd_error_handler)(
+          _("warning: memory region mapping for core %d of region 0x%lx already declared to 0x%lx\n"),
+          core,
+          p->origin,
+          p->alt_origin);
+      break;
+    }
   new_p = (memmap_t *) bfd_malloc (sizeof (memmap_t));
+  if (new_p == NULL)
+    return;
   new_p->core = core;
   new_p->origin = origin;
   new_p->length = length;
@@ -2112,6 +2545,32 @@ tricore_elf32_add_memory_map(unsigned int core, bfd_vma origin,
   tricore_region_map = new_p;
 }
 
+/* Forget the region maps declared for a link.  */
+static void
+tricore_elf32_memory_map_free (void)
+{
+  memmap_t *p, *next;
+
+  for (p = tricore_region_map; p; p = next)
+    {
+      next = p->next;
+      free (p);
+    }
+  tricore_region_map = NULL;
+}
+
+/* print statistics about the region map lookups */
+void
+tricore_elf32_print_memory_map_stats (struct bfd_link_info *info, FILE *out)
+{
+  struct tricore_elf32_link_hash_table *htab = tricore_elf32_hash_table (info);
+
+  if (htab == NULL || htab->region_map_count == 0)
+    return;
+  fprintf (out, _("memory region maps: %u, lookups: %lu\n"),
+	   htab->region_map_count, htab->region_map_lookups);
+}
+
 void print_region_maps(FILE *out)
 {
   if (tricore_region_map)
@@ -2135,7 +2594,8 @@ void print_region_maps(FILE *out)
 
 /* get an alternate address */
 static bfd_vma
-tricore_elf32_get_alternate_address(bfd_vma addr, unsigned int other,
+tricore_elf32_get_alternate_address(struct tricore_elf32_link_hash_table *htab,
+		                    bfd_vma addr, unsigned int other,
 		                    asection *sym_section, asection *osec)
 {
   memmap_t  *map;
@@ -2149,7 +2609,7 @@ tricore_elf32_get_alternate_address(bfd_vma addr, unsigned int other,
   if (sym_core == SHF_CORE_NUMBER_GET(osec->flags))
     return addr;
   core = sym_core;
-  map = tricore_elf32_memory_map_lookup(addr, core);
+  map = tricore_elf32_memory_map_lookup(htab, addr, core);
   if (map != 0)
       return (addr - map->origin) + map->alt_origin;
   return addr;
@@ -2159,8 +2619,6 @@ tricore_elf32_get_alternate_address(bfd_vma addr, unsigned int other,
 /* export Symbols all marked symbols into  */
 bool tricore_elf32_export_symbols = false;
 
-static struct elf_link_hash_table export_hash;
-
 /* add an exported symbol to hash table of exported symbols */
 void
 tricore_elf32_add_exported_symbol
@@ -2173,7 +2631,7 @@ tricore_elf32_add_exported_symbol
 TOCHECK	
   int obj_type = (type == true)? STT_EXPORT_FUNC: STT_EXPORT_OBJECT;
   struct elf_link_hash_entry *h;
-  h  = elf_link_hash_lookup(&export_hash, name, true, false, false);
+  h  = elf_link_hash_lookup(&htab->export_hash, name, true, false, false);
   if (h == NULL)
     return ;
   h->root.type = bfd_link_hash_defined;
@@ -2207,11 +2665,12 @@ tricore_elf32_export_add_sym(struct bfd_link_hash_entry *entry, void * parm)
 {
   struct elf_link_hash_entry *h = (struct elf_link_hash_entry *) entry;
   struct bfd_link_info *info = (struct bfd_link_info *) parm;
+  struct tricore_elf32_link_hash_table *htab = tricore_elf32_hash_table (info);
 
   if (( (h->root.type == bfd_link_hash_defined)
          ||  (h->root.type == bfd_link_hash_defweak)))
   {
-    const struct elf_link_hash_entry *he  = elf_link_hash_lookup(&export_hash,
+    const struct elf_link_hash_entry *he  = elf_link_hash_lookup(&htab->export_hash,
 	    h->root.root.string, false, false, false);
     const struct elf_backend_data *bed = 
 	    get_elf_backend_data (info->output_bfd);
@@ -2319,16 +2778,18 @@ tricore_elf32_reloc_type_class (const struct bfd_link_info *info ATTRIBUTE_UNUSE
    depending on the value of WHICH).  */
 static bool
 tricore_elf32_add_symbol_hook (bfd *abfd ATTRIBUTE_UNUSED,
-                            struct bfd_link_info *info ATTRIBUTE_UNUSED,
+                            struct bfd_link_info *info,
                             Elf_Internal_Sym *sym ATTRIBUTE_UNUSED,
                             const char **namep,
                             flagword *flagsp ATTRIBUTE_UNUSED,
                             asection **secp ATTRIBUTE_UNUSED,
                             bfd_vma *valp ATTRIBUTE_UNUSED)
 {
-  if (strncmp(*namep, "__caller.", 9) == 0 
-      || strncmp(*namep, "__callee.", 9) == 0)
-    tricore_elf32_add_call_symbol(*namep);
+  if ((strncmp(*namep, "__caller.", 9) == 0 
+       || strncmp(*namep, "__callee.", 9) == 0)
+      && tricore_elf32_hash_table (info) != NULL)
+    return tricore_elf32_add_call_symbol (tricore_elf32_hash_table (info),
+					  *namep);
   return true;
 }
 
@@ -2756,13 +3217,12 @@ tricore_elf32_relocate_section (bfd *output_bfd,
      Elf_Internal_Sym *local_syms,
      asection **local_sections)
 {
+  struct tricore_elf32_link_hash_table *htab = tricore_elf32_hash_table (info);
   struct elf_link_hash_entry **sym_hashes = elf_sym_hashes (input_bfd), *h;
   unsigned long r_symndx, insn;
   int sda_reg, rel_abs, len32 = 0, r_type;
   bool is_symbol_global;
   const char *sec_name, *errmsg = NULL;
-  static bool final_got = false;
-  static bool final_sda_bases = false;
   Elf_Internal_Shdr *symtab_hdr = &elf_tdata (input_bfd)->symtab_hdr;
   Elf_Internal_Sym *sym;
   Elf_Internal_Rela *rel, *relend;
@@ -2792,19 +3252,28 @@ tricore_elf32_relocate_section (bfd *output_bfd,
       break;								\
     }
 
-  if (!final_got && !bfd_link_relocatable(info))
+  if (htab == NULL)
+    return false;
+
+  /* Index the region maps for tricore_elf32_get_alternate_address.  */
+  if ((!htab->region_index_valid
+       || htab->region_index_head != tricore_region_map)
+      && !tricore_elf32_memory_map_build_index (htab))
+    return false;
+
+  if (!htab->final_got && !bfd_link_relocatable(info))
     {
       /* Determine the final values for "_GLOBAL_OFFSET_TABLE_" and the
          defined SDA symbols; also, if a map file is to be generated,
          show the addresses assigned to bit objects.  */
-      final_got = true;
+      htab->final_got = true;
       if (!tricore_elf32_final_gp (output_bfd, info))
         return false;
 
-      if (final_sda_bases == false)
+      if (!htab->final_sda_bases)
         {
           tricore_elf32_final_sda_bases (output_bfd, info,true);
-          final_sda_bases = true;
+          htab->final_sda_bases = true;
         }
     }
 
@@ -2922,7 +3391,7 @@ tricore_elf32_relocate_section (bfd *output_bfd,
 	  //sym_name = "<local symbol>";
 	  relocation = _bfd_elf_rela_local_sym (output_bfd, sym, &sec, rel);
           /* look for an alternate address */
-          reloc_alt = tricore_elf32_get_alternate_address (relocation,
+          reloc_alt = tricore_elf32_get_alternate_address (htab, relocation,
                                                         sym->st_other,
                                                         sec->output_section,
                                                         input_section->output_section);
@@ -2970,7 +3439,7 @@ tricore_elf32_relocate_section (bfd *output_bfd,
                                + sec->output_section->vma
 	                       + sec->output_offset);
               /* look for an alternate address */
-              reloc_alt = tricore_elf32_get_alternate_address (relocation,
+              reloc_alt = tricore_elf32_get_alternate_address (htab, relocation,
                                                             h->other,
                                                             sec->output_section,
                                                             input_section->output_section);
@@ -4575,23 +5044,6 @@ error_no_bit:
   return h2->root.u.def.value;
 }
 
-/* Search for the index of a global symbol in it's defining object file.  */
-
-static unsigned long
-global_sym_index (bfd *abfd, struct elf_link_hash_entry *h)
-{
-  struct elf_link_hash_entry **p;
-
-  BFD_ASSERT (h->root.type == bfd_link_hash_defined
-	      || h->root.type == bfd_link_hash_defweak);
-
-  for (p = elf_sym_hashes (abfd); *p != h; ++p)
-    continue;
-
-  return p - elf_sym_hashes (abfd) + elf_tdata (abfd)->symtab_hdr.sh_info;
-}
-
-
 /* Access to internal relocations, section contents and symbols.  */
 
 /* During relaxation, we need to modify relocations, section contents,
@@ -4695,408 +5147,767 @@ retrieve_local_syms (bfd *input_bfd)
 }
 
 
-/* This is called once by tricore_elf32_relocate_section, and only if
-   the linker was directed to create a map file.  We walk through all
-   input BFDs (in link order) and print out all allocated bit objects
-   (note that garbage collection ("--gc-sections") and bit relaxation
-   ("-relax"|"--relax-bdata") have already been performed formerly in
-   case they were requested by the user).  */
+/* Index of bit objects.  */
 
-void
-tricore_elf32_list_bit_objects (struct bfd_link_info *info, FILE *out)
-{
-  bfd *ibfd;
-  asection *bdata, *boffs;
-  bool header_printed = false;
-  Elf_Internal_Shdr *symtab_hdr, *strtab_hdr;
-  Elf_Internal_Sym *isymbuf;
-  unsigned char *strtab;
-  unsigned int symcount;
-  unsigned int boffs_shndx;
-  struct elf_link_hash_entry **beg_hashes, **end_hashes, **sym_hashes;
+/* Compressing bit sections and listing the allocated bit objects both
+   need to pair each bit symbol with its "name.pos" symbol, and the
+   compression has to find all relocs referencing a bit object by its
+   old offset.  Rather than rescanning the symbol tables and all relocs
+   of an input object for every single bit object, we collect these
+   once per input object into a bit_section_t per bit section, which is
+   kept in the relaxation context and indexed by section id.  */
 
-  for (ibfd = info->input_bfds; ibfd; ibfd = ibfd->link.next)
-    {
-      /* If this input BFD doesn't have a ".boffs" section, it also
-         won't have any bit sections, so we can safely skip it.  */
-      if (((boffs = bfd_get_section_by_name (ibfd, ".boffs")) == NULL)
-          || (bfd_section_flags (boffs) & SEC_EXCLUDE)
-	  || (boffs->rawsize != 0))
-	continue;
+static bool
+tricore_elf32_bit_section_p (const char *name)
+{
+  return (!strcmp (name, ".bdata")
+	  || !strncmp (name, ".bdata.", 7)
+	  || !strcmp (name, ".bbss")
+	  || !strncmp (name, ".bbss.", 6));
+}
 
-      boffs_shndx = _bfd_elf_section_from_bfd_section (ibfd, boffs);
-      isymbuf = NULL;
-      strtab = NULL;
-      symtab_hdr = &elf_tdata (ibfd)->symtab_hdr;
-      if (symtab_hdr->sh_info != 0)
-        {
-          isymbuf = retrieve_local_syms(ibfd);
-	  if (isymbuf == NULL)
-	    continue;  /* This error will be catched elsewhere.  */
+/* Return the string table of the symbols of ABFD.  */
 
-	  strtab_hdr = &elf_tdata (ibfd)->strtab_hdr;
-	  strtab = strtab_hdr->contents;
-	  if (strtab == NULL)
-	    {
-              (void)bfd_elf_string_from_elf_section(ibfd, symtab_hdr->sh_link,1);
-	    //  bfd_elf_get_str_section (ibfd, symtab_hdr->sh_link);
-	      strtab = strtab_hdr->contents;
-	    }
-	  BFD_ASSERT (strtab);
-	}
+static unsigned char *
+retrieve_strtab (bfd *abfd)
+{
+  Elf_Internal_Shdr *symtab_hdr = &elf_tdata (abfd)->symtab_hdr;
+  Elf_Internal_Shdr *strtab_hdr = &elf_tdata (abfd)->strtab_hdr;
 
-      /* Iterate over the sections of this BFD; skip non-bit sections.  */
-      for (bdata = ibfd->sections; bdata; bdata = bdata->next)
-	{
-          if ((bfd_section_flags (bdata) & SEC_EXCLUDE)
-	      || (bdata->rawsize == 0)
-	      || (strcmp (bdata->name, ".bdata")
-	          && strncmp (bdata->name, ".bdata.", 7)
-		  && strcmp (bdata->name, ".bbss")
-		  && strncmp (bdata->name, ".bbss.", 6)))
-	    continue;
+  if (strtab_hdr->contents == NULL)
+    (void) bfd_elf_string_from_elf_section (abfd, symtab_hdr->sh_link, 1);
+  return strtab_hdr->contents;
+}
 
-	  if (!header_printed)
-	    {
-	      fprintf (out, "\n%s\n",
-	  	       _("Allocating bit symbols (l/g = local or global "
-		         "scope)"));
-	      fprintf (out, "%s\n\n",
-	  	       _("Bit symbol          bit address  l/g  file"));
-	      header_printed = true;
-	    }
+/* Maps a global symbol of an input object to its symbol index.  */
 
-	  /* Walk through all local symbols in this section.  */
-          if (isymbuf != NULL)
-	    {
-	      Elf_Internal_Sym *isym, *isymend = isymbuf + symtab_hdr->sh_info;
-              const char *this_file = NULL, *this_base = NULL;
-	      unsigned int bdata_shndx;
+typedef struct bit_hash_key
+{
+  struct elf_link_hash_entry *h;
+  unsigned long indx;
+} bit_hash_key_t;
 
-	      bdata_shndx = _bfd_elf_section_from_bfd_section (ibfd, bdata);
-	      for (isym = isymbuf; isym < isymend; ++isym)
-	        {
-	          if (ELF_ST_TYPE (isym->st_info) == STT_FILE)
-	            {
-	              this_file = (const char *)(strtab + isym->st_name);
-		      this_base = strchr (this_file, '.');
-		      continue;
-		    }
+static int
+tricore_elf32_bit_hash_compare (const void *a, const void *b)
+{
+  const bit_hash_key_t *ka = (const bit_hash_key_t *) a;
+  const bit_hash_key_t *kb = (const bit_hash_key_t *) b;
 
-	          if ((isym->st_shndx == bdata_shndx)
-	              && (ELF_ST_TYPE (isym->st_info) == STT_OBJECT))
-		    {
-		      Elf_Internal_Sym *isym2;
-		      char *aname;
-		      size_t len;
+  if (ka->h != kb->h)
+    return (ka->h < kb->h) ? -1 : 1;
+  return (ka->indx < kb->indx) ? -1 : (ka->indx > kb->indx);
+}
 
-		      aname = (char *)strtab + isym->st_name;
-		      len = strlen (aname);
-		      if (isym->st_size != 1)
-		        {
-		          (*_bfd_error_handler)
-		           (_("%s: bit symbol \"%s\" has size != 1 (%ld)"),
-		            bfd_get_filename(ibfd), aname, isym->st_size);
-		          bfd_set_error (bfd_error_bad_value);
-		          continue;
-		        }
-		      for (isym2 = isym + 1; isym2 < isymend; ++isym2)
-		        {
-			  const char *aname2;
-
-		          /* Bail out if this symbol indicates the beginning
-		             of a new file, as this means that the ".pos"
-			     symbol is missing in the current file (shouldn't
-			     really happen, but just in case).  */
-	                  if (ELF_ST_TYPE (isym2->st_info) == STT_FILE)
-		            {
-			      isym2 = isymend;
-			      break;
-			    }
-
-			  aname2 = (char *)(strtab + isym2->st_name);
-		          if ((isym2->st_shndx == boffs_shndx)
-			      && (ELF_ST_TYPE (isym2->st_info) == STT_NOTYPE)
-			      && (strlen (aname2) == (len + 4))
-			      && !strncmp (aname2, aname, len)
-			      && !strcmp (aname2 + len, ".pos"))
-			    {
-			      fprintf (out, "%-19s 0x%08lx.%ld  l   %s",
-			  	       aname,
-				       (bdata->output_section->vma
-				        + bdata->output_offset
-				        + isym->st_value),
-				       isym2->st_value,
-				       bfd_get_filename(ibfd));
-
-			      /* If this is an input object that is the result
-			         of a relocateable link run, also print the
-				 name of the original file that defined this
-				 bit object.  */
-			      if (this_file
-			          && this_base
-			          && strncmp (this_file, ibfd->filename,
-			      		      this_base - this_file))
-			        fprintf (out, " <%s>", this_file);
-			      fprintf (out, "\n");
-			      break;
-			    }
-		        }
-		      if (isym2 == isymend)
-		        {
-#ifndef FATAL_BITVAR_ERRORS
-		          (*_bfd_error_handler)
-		           (_("%s: warning: missing or invalid local bit "
-			      "position "
-		              "symbol \"%s.pos\" in section \".boffs\""),
-			    bfd_get_filename(ibfd), aname);
-#else
-		          (*_bfd_error_handler)
-		           (_("%s: missing or invalid local bit position "
-		              "symbol \"%s.pos\" in section \".boffs\""),
-			    bfd_get_filename(ibfd), aname);
-		          bfd_set_error (bfd_error_bad_value);
-#endif
-		        }
-		    }
-	        }
-	    }
+static int
+tricore_elf32_bit_reloc_compare (const void *a, const void *b)
+{
+  const bit_reloc_t *ra = (const bit_reloc_t *) a;
+  const bit_reloc_t *rb = (const bit_reloc_t *) b;
 
-	  /* Walk through all global symbols in this section.  */
-          symcount = (symtab_hdr->sh_size / sizeof (Elf32_External_Sym)
-      		      - symtab_hdr->sh_info);
-          beg_hashes = elf_sym_hashes (ibfd);
-          end_hashes = elf_sym_hashes (ibfd) + symcount;
-          for (sym_hashes = beg_hashes; sym_hashes < end_hashes; ++sym_hashes)
-	    {
-	      struct elf_link_hash_entry *sym = *sym_hashes;
+  if (ra->addend != rb->addend)
+    return (ra->addend < rb->addend) ? -1 : 1;
+  return (ra->order < rb->order) ? -1 : (ra->order > rb->order);
+}
 
-	      if ((sym->root.u.def.section == bdata)
-	          && (sym->type == STT_OBJECT)
-	          && ((sym->root.type == bfd_link_hash_defined)
-	              || (sym->root.type == bfd_link_hash_defweak)))
-	        {
-	          struct elf_link_hash_entry *sym2;
-	          const char *aname = sym->root.root.string;
-	          char *pname;
-	          size_t len;
-
-	          if (sym->size != 1)
-	            {
-		      (*_bfd_error_handler)
-		       (_("%s: bit symbol \"%s\" has size != 1 (%ld)"),
-		        bfd_get_filename(ibfd), aname, sym->size);
-		      bfd_set_error (bfd_error_bad_value);
-	              continue;
-	            }
-
-	          /* Lookup the global symbol "aname.pos", which should be
-	             defined in section ".boffs" and have type STT_NOTYPE.  */
-	          len = strlen (aname) + 5;
-	          if ((pname = bfd_malloc (len)) == NULL)
-	            return;
-
-		  sprintf (pname, "%s.pos", aname);
-	          sym2 = (struct elf_link_hash_entry *)
-	      	          bfd_link_hash_lookup (info->hash, pname,
-	      				        false, false, false);
-	          if ((sym2 == NULL)
-		      || (sym2->root.u.def.section != boffs)
-	              || (sym2->type != STT_NOTYPE))
-		    {
-		      (*_bfd_error_handler)
-		       (_("%s: missing or invalid bit position symbol \"%s\""),
-		        bfd_get_filename(ibfd), pname);
-		      bfd_set_error (bfd_error_bad_value);
-		      free (pname);
-		      continue;
-		    }
+/* Return the bit section of ABFD with section index SHNDX, or NULL.  */
 
-	          free (pname);
-	          fprintf (out, "%-19s 0x%08lx.%ld  g   %s\n",
-		           aname,
-		           (bdata->output_section->vma
-			    + bdata->output_offset
-			    + sym->root.u.def.value),
-		           sym2->root.u.def.value,
-		           bfd_get_filename(ibfd));
-	        }
-	    }
-        }
-    }
+static bit_section_t *
+tricore_elf32_bit_section_by_shndx (bit_section_t **by_shndx,
+				    unsigned int num_shndx,
+				    unsigned int shndx)
+{
+  return (shndx < num_shndx) ? by_shndx[shndx] : NULL;
 }
 
-/* Adjust all relocs contained in input object ABFD that reference the
-   given bit object: SECIDX is the index of a bit section, OLD is the
-   former offset of the bit address within this section, NEW is the
-   new offset, BPOS is the new bit position (0..7), BIDX is the symbol
-   index of the symbol representing that bit offset (i.e., "name.pos" in
-   section ".boffs"), and INFO is a pointer to the link info structure.  */
+/* Collect the bit objects defined in the bit sections of ABFD.  */
 
 static bool
-tricore_elf32_adjust_bit_relocs (bfd *abfd,
-     struct bfd_link_info *info,
-     unsigned long secidx,
-     bfd_vma old,
-     bfd_vma new,
-     int bpos,
-     unsigned int bidx)
+tricore_elf32_index_bit_symbols (struct tricore_relax_context *ctx,
+				 bfd *abfd,
+				 struct bfd_link_info *info)
 {
-  Elf_Internal_Shdr *symtab_hdr;
-  Elf_Internal_Rela *internal_relocs;
-  Elf_Internal_Rela *irel, *irelend;
-  Elf_Internal_Rela *lastrel = NULL;
-  Elf_Internal_Sym *isymbuf, *sym;
-  unsigned long symidx;
+  Elf_Internal_Shdr *symtab_hdr = &elf_tdata (abfd)->symtab_hdr;
+  Elf_Internal_Sym *isymbuf, *isym, *isym2, *isymend;
+  struct elf_link_hash_entry **sym_hashes;
+  bit_hash_key_t *keys = NULL;
+  bit_section_t **by_shndx, *bs;
+  unsigned int num_shndx = elf_numsections (abfd);
+  unsigned int boffs_shndx = SHN_BAD;
+  unsigned long symcount, i, nkeys;
+  unsigned char *strtab;
+  const char *file = NULL;
+  char *pname = NULL;
+  size_t pname_max = 0;
+  asection *sec, *boffs;
+  bool found = false;
+
+  by_shndx = (bit_section_t **) bfd_zmalloc (num_shndx * sizeof (*by_shndx));
+  if (by_shndx == NULL)
+    return false;
+
+  for (sec = abfd->sections; sec != NULL; sec = sec->next)
+    {
+      unsigned int shndx;
+
+      if (sec->id >= ctx->num_bit_sections
+	  || !tricore_elf32_bit_section_p (sec->name))
+	continue;
+
+      shndx = _bfd_elf_section_from_bfd_section (abfd, sec);
+      if (shndx >= num_shndx)
+	continue;
+
+      bs = (bit_section_t *) objalloc_alloc (ctx->memory, sizeof (*bs));
+      if (bs == NULL)
+	{
+	  bfd_set_error (bfd_error_no_memory);
+	  goto error_return;
+	}
+      memset (bs, 0, sizeof (*bs));
+      bs->sec = sec;
+      bs->shndx = shndx;
+      by_shndx[shndx] = bs;
+      found = true;
+    }
+  if (!found)
+    {
+      free (by_shndx);
+      return true;
+    }
+
+  boffs = bfd_get_section_by_name (abfd, ".boffs");
+  if (boffs != NULL)
+    boffs_shndx = _bfd_elf_section_from_bfd_section (abfd, boffs);
+
+  /* Local bit objects: count them per section first, then pair each
+     one with its bit position symbol.  */
+  if (symtab_hdr->sh_info != 0)
+    {
+      isymbuf = retrieve_local_syms (abfd);
+      strtab = retrieve_strtab (abfd);
+      if (isymbuf == NULL || strtab == NULL)
+	goto error_return;
+
+      isymend = isymbuf + symtab_hdr->sh_info;
+      for (isym = isymbuf; isym < isymend; ++isym)
+	if (ELF_ST_TYPE (isym->st_info) == STT_OBJECT
+	    && (bs = tricore_elf32_bit_section_by_shndx (by_shndx, num_shndx,
+							 isym->st_shndx)))
+	  ++bs->num_locals;
+
+      for (i = 0; i < num_shndx; ++i)
+	if ((bs = by_shndx[i]) != NULL && bs->num_locals != 0)
+	  {
+	    bs->locals = (bit_object_t *)
+	      objalloc_alloc (ctx->memory, bs->num_locals * sizeof (bit_object_t));
+	    if (bs->locals == NULL)
+	      {
+		bfd_set_error (bfd_error_no_memory);
+		goto error_return;
+	      }
+	    bs->num_locals = 0;
+	  }
+
+      for (isym = isymbuf; isym < isymend; ++isym)
+	{
+	  bit_object_t *obj;
+	  const char *aname;
+	  size_t len;
+
+	  if (ELF_ST_TYPE (isym->st_info) == STT_FILE)
+	    {
+	      file = (const char *) (strtab + isym->st_name);
+	      continue;
+	    }
+	  if (ELF_ST_TYPE (isym->st_info) != STT_OBJECT
+	      || !(bs = tricore_elf32_bit_section_by_shndx (by_shndx, num_shndx,
+							    isym->st_shndx)))
+	    continue;
+
+	  obj = &bs->locals[bs->num_locals++];
+	  obj->sym = isym - isymbuf;
+	  obj->pos = (unsigned long) -1;
+	  obj->file = file;
+	  obj->h = obj->pos_h = NULL;
+
+	  /* The bit position symbol may be defined anywhere between the
+	     bit symbol and the next STT_FILE symbol, but tricore-as puts
+	     it right after the bit symbol, so this loop usually stops at
+	     its first iteration.  */
+	  aname = (const char *) (strtab + isym->st_name);
+	  len = strlen (aname);
+	  for (isym2 = isym + 1; isym2 < isymend; ++isym2)
+	    {
+	      const char *aname2 = (const char *) (strtab + isym2->st_name);
+
+	      if (ELF_ST_TYPE (isym2->st_info) == STT_FILE)
+		break;
+	      if (isym2->st_shndx == boffs_shndx
+		  && ELF_ST_TYPE (isym2->st_info) == STT_NOTYPE
+		  && !strncmp (aname2, aname, len)
+		  && !strcmp (aname2 + len, ".pos"))
+		{
+		  obj->pos = isym2 - isymbuf;
+		  break;
+		}
+	    }
+	}
+    }
+
+  /* Global bit objects, in the order of this object's symbol table.  */
+  symcount = (symtab_hdr->sh_size / sizeof (Elf32_External_Sym)
+	      - symtab_hdr->sh_info);
+  sym_hashes = elf_sym_hashes (abfd);
+  if (sym_hashes == NULL)
+    symcount = 0;
+  for (i = 0; i < symcount; ++i)
+    {
+      struct elf_link_hash_entry *h = sym_hashes[i];
+
+      if (h != NULL
+	  && (h->root.type == bfd_link_hash_defined
+	      || h->root.type == bfd_link_hash_defweak)
+	  && h->type == STT_OBJECT
+	  && h->root.u.def.section->owner == abfd
+	  && (bs = tricore_elf32_bit_section_by_shndx
+		(by_shndx, num_shndx,
+		 _bfd_elf_section_from_bfd_section (abfd,
+						    h->root.u.def.section))))
+	++bs->num_globals;
+    }
+
+  nkeys = 0;
+  for (i = 0; i < num_shndx; ++i)
+    if ((bs = by_shndx[i]) != NULL && bs->num_globals != 0)
+      {
+	bs->globals = (bit_object_t *)
+	  objalloc_alloc (ctx->memory, bs->num_globals * sizeof (bit_object_t));
+	if (bs->globals == NULL)
+	  {
+	    bfd_set_error (bfd_error_no_memory);
+	    goto error_return;
+	  }
+	nkeys += bs->num_globals;
+	bs->num_globals = 0;
+      }
+
+  if (nkeys != 0)
+    {
+      /* Sort this object's global symbols by their hash entries, so
+	 that the symbol index of "name.pos" can be looked up quickly.  */
+      keys = (bit_hash_key_t *) bfd_malloc (symcount * sizeof (*keys));
+      if (keys == NULL)
+	goto error_return;
+      for (nkeys = 0, i = 0; i < symcount; ++i)
+	if (sym_hashes[i] != NULL)
+	  {
+	    keys[nkeys].h = sym_hashes[i];
+	    keys[nkeys++].indx = i;
+	  }
+      qsort (keys, nkeys, sizeof (*keys), tricore_elf32_bit_hash_compare);
+    }
+
+  for (i = 0; keys != NULL && i < symcount; ++i)
+    {
+      struct elf_link_hash_entry *h = sym_hashes[i];
+      bit_object_t *obj;
+      size_t len, lo, hi;
+
+      if (h == NULL
+	  || (h->root.type != bfd_link_hash_defined
+	      && h->root.type != bfd_link_hash_defweak)
+	  || h->type != STT_OBJECT
+	  || h->root.u.def.section->owner != abfd
+	  || !(bs = tricore_elf32_bit_section_by_shndx
+		 (by_shndx, num_shndx,
+		  _bfd_elf_section_from_bfd_section (abfd,
+						     h->root.u.def.section))))
+	continue;
+
+      obj = &bs->globals[bs->num_globals++];
+      obj->sym = i + symtab_hdr->sh_info;
+      obj->pos = (unsigned long) -1;
+      obj->file = NULL;
+      obj->h = h;
+
+      /* Lookup the global symbol "name.pos".  */
+      len = strlen (h->root.root.string) + 5;
+      if (len > pname_max)
+	{
+	  char *p = (char *) bfd_realloc (pname, len);
+
+	  if (p == NULL)
+	    goto error_return;
+	  pname = p;
+	  pname_max = len;
+	}
+      sprintf (pname, "%s.pos", h->root.root.string);
+      obj->pos_h = (struct elf_link_hash_entry *)
+	bfd_link_hash_lookup (info->hash, pname, false, false, false);
+      if (obj->pos_h == NULL)
+	continue;
+
+      for (lo = 0, hi = nkeys; lo < hi; )
+	{
+	  size_t mid = lo + (hi - lo) / 2;
+
+	  if (keys[mid].h < obj->pos_h)
+	    lo = mid + 1;
+	  else
+	    hi = mid;
+	}
+      if (lo < nkeys && keys[lo].h == obj->pos_h)
+	obj->pos = keys[lo].indx + symtab_hdr->sh_info;
+    }
+
+  for (i = 0; i < num_shndx; ++i)
+    if ((bs = by_shndx[i]) != NULL)
+      ctx->bit_sections[bs->sec->id] = bs;
+
+  free (pname);
+  free (keys);
+  free (by_shndx);
+  return true;
+
+ error_return:
+  free (pname);
+  free (keys);
+  free (by_shndx);
+  return false;
+}
+
+/* Collect the relocs of ABFD against the section symbols of its bit
+   sections.  The relocs are pinned in memory, as they are modified by
+   tricore_elf32_adjust_bit_relocs.  */
+
+static bool
+tricore_elf32_index_bit_relocs (struct tricore_relax_context *ctx,
+				bfd *abfd,
+				struct bfd_link_info *info)
+{
+  Elf_Internal_Shdr *symtab_hdr = &elf_tdata (abfd)->symtab_hdr;
+  Elf_Internal_Sym *isymbuf = NULL;
+  Elf_Internal_Rela *internal_relocs, *irel, *irelend;
+  bit_section_t **by_shndx, *bs;
+  unsigned int num_shndx = elf_numsections (abfd);
+  unsigned int order, i;
   asection *sec;
-  int r_type;
-  bool bitoff_seen = false;
-  static bool initialized = false;
-  static char **reloc_adjusted;
+  int pass;
 
-  /* If nothing changes, return immediately.  */
-  if ((old == new) && (bpos == 0))
-    return true;
+  by_shndx = (bit_section_t **) bfd_zmalloc (num_shndx * sizeof (*by_shndx));
+  if (by_shndx == NULL)
+    return false;
+
+  for (sec = abfd->sections; sec != NULL; sec = sec->next)
+    if (sec->id < ctx->num_bit_sections
+	&& (bs = ctx->bit_sections[sec->id]) != NULL)
+      by_shndx[bs->shndx] = bs;
 
-  /* We must remember which relocations we've already changed, as we have
-     to avoid modifying the same relocation multiple times.  Why?  Well,
-     consider the following case: first we change a relocation from, say,
-     .bdata+42 to .bdata+3 (note that it doesn't matter whether we're also
-     (or merely) changing the bit position); then another, yet unmodified
-     relocation references .bdata+3, which should now, after relaxation,
-     be changed into a relocation against .bdata+7.  Without remembering
-     which relocs we've already changed, we would again modify the already
-     modified relocation against .bdata+3 (which was originally against
-     .bdata+42) -- ouch!  Unfortunately, this ain't too obvious...  */
-  if (!initialized)
+  if (symtab_hdr->sh_info != 0)
     {
-      int i, max = -1;
+      isymbuf = retrieve_local_syms (abfd);
+      if (isymbuf == NULL)
+	goto error_return;
+    }
+
+  /* Count the relocs per bit section in the first pass, and record
+     them in the second one.  */
+  for (pass = 0; isymbuf != NULL && pass < 2; ++pass)
+    {
+      order = 0;
+      for (sec = abfd->sections; sec != NULL; sec = sec->next)
+	{
+	  if ((sec->flags & SEC_RELOC) == 0
+	      || sec->reloc_count == 0
+	      || (sec->flags & SEC_LINKER_CREATED) != 0)
+	    continue;
+
+	  internal_relocs = retrieve_internal_relocs (abfd, sec,
+						      info->keep_memory);
+	  if (internal_relocs == NULL)
+	    goto error_return;
+	  pin_internal_relocs (sec, internal_relocs);
+
+	  irelend = internal_relocs + sec->reloc_count;
+	  for (irel = internal_relocs; irel < irelend; ++irel, ++order)
+	    {
+	      int r_type = ELF32_R_TYPE (irel->r_info);
+	      unsigned long symidx = ELF32_R_SYM (irel->r_info);
+	      Elf_Internal_Sym *sym;
+	      bit_reloc_t *br;
+
+	      if ((r_type < 0)
+		  || (r_type < R_TRICORE_NONE)
+		  || (r_type >= R_TRICORE_max))
+		{
+		  (*_bfd_error_handler) (_("%s: unknown relocation type %d"),
+					 sec->name, r_type);
+		  bfd_set_error (bfd_error_bad_value);
+		  goto error_return;
+		}
+	      if (r_type == R_TRICORE_NONE
+		  || r_type == R_TRICORE_BITPOS
+		  || symidx >= symtab_hdr->sh_info)
+		continue;
+
+	      sym = isymbuf + symidx;
+	      if (ELF_ST_TYPE (sym->st_info) != STT_SECTION
+		  || !(bs = tricore_elf32_bit_section_by_shndx
+			 (by_shndx, num_shndx, sym->st_shndx)))
+		continue;
+
+	      if (pass == 0)
+		{
+		  ++bs->num_relocs;
+		  continue;
+		}
+
+	      br = &bs->relocs[bs->num_relocs++];
+	      br->irel = irel;
+	      br->bitpos = NULL;
+	      if (irel > internal_relocs
+		  && ELF32_R_TYPE (irel[-1].r_info) == R_TRICORE_BITPOS
+		  && irel[-1].r_addend == irel->r_addend)
+		br->bitpos = irel - 1;
+	      br->sec = sec;
+	      br->addend = irel->r_addend;
+	      br->order = order;
+	      br->adjusted = false;
+	    }
+	}
+
+      for (i = 0; pass == 0 && i < num_shndx; ++i)
+	if ((bs = by_shndx[i]) != NULL && bs->num_relocs != 0)
+	  {
+	    bs->relocs = (bit_reloc_t *)
+	      objalloc_alloc (ctx->memory, bs->num_relocs * sizeof (bit_reloc_t));
+	    if (bs->relocs == NULL)
+	      {
+		bfd_set_error (bfd_error_no_memory);
+		goto error_return;
+	      }
+	    bs->num_relocs = 0;
+	  }
+    }
+
+  for (i = 0; i < num_shndx; ++i)
+    if ((bs = by_shndx[i]) != NULL)
+      {
+	if (bs->num_relocs > 1)
+	  qsort (bs->relocs, bs->num_relocs, sizeof (bit_reloc_t),
+		 tricore_elf32_bit_reloc_compare);
+	bs->relocs_indexed = true;
+      }
+
+  free (by_shndx);
+  return true;
+
+ error_return:
+  free (by_shndx);
+  return false;
+}
+
+/* Set *BSP to the index entry of bit section SEC of input object ABFD,
+   indexing all bit sections of ABFD if this hasn't been done yet.  If
+   RELOCS is true, the relocs against these sections are indexed, too.
+   *BSP is set to NULL if SEC is not a bit section.  Return false on
+   error.  */
+
+static bool
+tricore_elf32_bit_index (bfd *abfd,
+			 asection *sec,
+			 struct bfd_link_info *info,
+			 bool relocs,
+			 bit_section_t **bsp)
+{
+  struct tricore_relax_context *ctx = tricore_elf32_relax_ctx (info);
+  bit_section_t *bs;
+
+  *bsp = NULL;
+  if (ctx == NULL)
+    {
+      bfd_set_error (bfd_error_wrong_format);
+      return false;
+    }
+
+  if (ctx->bit_sections == NULL)
+    {
+      unsigned int max = 0;
       bfd *ibfd;
       asection *section;
 
       /* Find the highest section ID of all input sections.  */
       for (ibfd = info->input_bfds; ibfd; ibfd = ibfd->link.next)
-        for (section = ibfd->sections; section; section = section->next)
-	  if ((int) section->id > max)
+	for (section = ibfd->sections; section; section = section->next)
+	  if (section->id > max)
 	    max = section->id;
-
       ++max;
-      if ((reloc_adjusted = bfd_malloc (max * sizeof (char *))) == NULL)
-        return false;
+      ctx->bit_sections = (bit_section_t **)
+	objalloc_alloc (ctx->memory, max * sizeof (bit_section_t *));
+      if (ctx->bit_sections == NULL)
+	{
+	  bfd_set_error (bfd_error_no_memory);
+	  return false;
+	}
+      memset (ctx->bit_sections, 0, max * sizeof (bit_section_t *));
+      ctx->num_bit_sections = max;
+    }
 
-      for (i = 0; i < max; ++i)
-	reloc_adjusted[i] = NULL;
+  if (sec->id >= ctx->num_bit_sections)
+    return true;
 
-      initialized = true;
-    }
+  if (ctx->bit_sections[sec->id] == NULL
+      && !tricore_elf32_index_bit_symbols (ctx, abfd, info))
+    return false;
 
-  symtab_hdr = &elf_tdata (abfd)->symtab_hdr;
-  isymbuf = retrieve_local_syms(abfd);
+  bs = ctx->bit_sections[sec->id];
+  if (bs != NULL
+      && relocs
+      && !bs->relocs_indexed
+      && !tricore_elf32_index_bit_relocs (ctx, abfd, info))
+    return false;
 
-  for (sec = abfd->sections; sec != NULL; sec = sec->next)
+  *bsp = bs;
+  return true;
+}
+
+
+/* This is called once by tricore_elf32_relocate_section, and only if
+   the linker was directed to create a map file.  We walk through all
+   input BFDs (in link order) and print out all allocated bit objects
+   (note that garbage collection ("--gc-sections") and bit relaxation
+   ("-relax"|"--relax-bdata") have already been performed formerly in
+   case they were requested by the user).  Return false if the bit
+   sections could not be indexed.  */
+
+bool
+tricore_elf32_list_bit_objects (struct bfd_link_info *info, FILE *out)
+{
+  bfd *ibfd;
+  asection *bdata, *boffs;
+  bool header_printed = false;
+  Elf_Internal_Shdr *symtab_hdr;
+  Elf_Internal_Sym *isymbuf;
+  unsigned char *strtab;
+  bit_section_t *bs;
+  unsigned int i;
+
+  for (ibfd = info->input_bfds; ibfd; ibfd = ibfd->link.next)
     {
-      if (((sec->flags & SEC_RELOC) == 0)
-          || (sec->reloc_count == 0))
+      /* If this input BFD doesn't have a ".boffs" section, it also
+         won't have any bit sections, so we can safely skip it.  */
+      if (((boffs = bfd_get_section_by_name (ibfd, ".boffs")) == NULL)
+          || (bfd_section_flags (boffs) & SEC_EXCLUDE)
+	  || (boffs->rawsize != 0))
 	continue;
 
-      internal_relocs = retrieve_internal_relocs(abfd, sec,
-                                                 info->keep_memory);
-      if (internal_relocs == NULL)
-        return false;
-
-      if (!reloc_adjusted[sec->id])
+      isymbuf = NULL;
+      strtab = NULL;
+      symtab_hdr = &elf_tdata (ibfd)->symtab_hdr;
+      if (symtab_hdr->sh_info != 0)
         {
-	  if ((reloc_adjusted[sec->id] = bfd_malloc (sec->reloc_count)) == NULL)
-	    return false;
+          isymbuf = retrieve_local_syms(ibfd);
+	  if (isymbuf == NULL)
+	    continue;  /* This error will be catched elsewhere.  */
 
-	  memset (reloc_adjusted[sec->id], 0, sec->reloc_count);
+	  strtab = retrieve_strtab (ibfd);
+	  BFD_ASSERT (strtab);
 	}
 
-      irelend = internal_relocs + sec->reloc_count;
-      for (irel = internal_relocs; irel < irelend; irel++)
-        {
-	  if (irel->r_addend != old)
-	    {
-	      bitoff_seen = false;
-	      continue;
-	    }
+      /* Iterate over the sections of this BFD; skip non-bit sections.  */
+      for (bdata = ibfd->sections; bdata; bdata = bdata->next)
+	{
+          if ((bfd_section_flags (bdata) & SEC_EXCLUDE)
+	      || (bdata->rawsize == 0)
+	      || !tricore_elf32_bit_section_p (bdata->name))
+	    continue;
 
-	  r_type = ELF32_R_TYPE (irel->r_info);
-	  if ((r_type == R_TRICORE_NONE)
-	      || reloc_adjusted[sec->id][irel - internal_relocs])
-	    {
-	      /* Don't touch an already modified reloc; see comment above.  */
-	      bitoff_seen = false;
-	      continue;
-	    }
-          if ((r_type < 0)
-              || (r_type < R_TRICORE_NONE)
-	      || (r_type >= R_TRICORE_max))
-	    {
-	      (*_bfd_error_handler) (_("%s: unknown relocation type %d"),
-				     sec->name, r_type);
-	      bfd_set_error (bfd_error_bad_value);
-	      return false;
-	    }
-	  if (r_type == R_TRICORE_BITPOS)
-	    {
-	      bitoff_seen = true;
-	      lastrel = irel;
-	      continue;
-	    }
+	  if (!tricore_elf32_bit_index (ibfd, bdata, info, false, &bs))
+	    return false;
+	  if (bs == NULL)
+	    continue;
 
-	  symidx = ELF32_R_SYM (irel->r_info);
-	  if (symidx >= symtab_hdr->sh_info)
+	  if (!header_printed)
 	    {
-	      /* Relocation against a global symbol.  Can be safely
-	         ignored, because even if bitoff_seen is true and
-		 this symbol turns out to not represent a bit symbol,
-		 this will be catched either by the relaxation pass
-		 or later by tricore_elf32_relocate_section when it
-		 calls tricore_elf32_get_bitpos.  */
-	      bitoff_seen = false;
-	      continue;
+	      fprintf (out, "\n%s\n",
+	  	       _("Allocating bit symbols (l/g = local or global "
+		         "scope)"));
+	      fprintf (out, "%s\n\n",
+	  	       _("Bit symbol          bit address  l/g  file"));
+	      header_printed = true;
 	    }
 
-	  sym = isymbuf + symidx;
-	  if ((sym->st_shndx != secidx)
-	      || (ELF_ST_TYPE (sym->st_info) != STT_SECTION))
+	  /* Walk through all local symbols in this section.  */
+	  for (i = 0; i < bs->num_locals; ++i)
 	    {
-	      /* This symbol doesn't belong to the given bit section,
-	         or the relocation is not against the section symbol.  */
-	      bitoff_seen = false;
-	      continue;
-	    }
+	      bit_object_t *obj = &bs->locals[i];
+	      Elf_Internal_Sym *isym = isymbuf + obj->sym;
+	      const char *this_file = obj->file, *this_base = NULL;
+	      char *aname;
 
-	  if (tricore_elf32_debug_relax)
-	    {
-	      asection *bsec;
+	      aname = (char *)strtab + isym->st_name;
+	      if (isym->st_size != 1)
+		{
+		  (*_bfd_error_handler)
+		   (_("%s: bit symbol \"%s\" has size != 1 (%ld)"),
+		    bfd_get_filename(ibfd), aname, isym->st_size);
+		  bfd_set_error (bfd_error_bad_value);
+		  continue;
+		}
+
+	      if (obj->pos == (unsigned long) -1)
+		{
+#ifndef FATAL_BITVAR_ERRORS
+		  (*_bfd_error_handler)
+		   (_("%s: warning: missing or invalid local bit "
+		      "position "
+		      "symbol \"%s.pos\" in section \".boffs\""),
+		    bfd_get_filename(ibfd), aname);
+#else
+		  (*_bfd_error_handler)
+		   (_("%s: missing or invalid local bit position "
+		      "symbol \"%s.pos\" in section \".boffs\""),
+		    bfd_get_filename(ibfd), aname);
+		  bfd_set_error (bfd_error_bad_value);
+#endif
+		  continue;
+		}
 
-	      bsec = bfd_section_from_elf_index (abfd, sym->st_shndx);
-	      printf ("    %s+%ld: symbol at %s+%ld, changing ",
-	              sec->name, irel->r_offset, bsec->name, irel->r_addend);
+	      fprintf (out, "%-19s 0x%08lx.%ld  l   %s",
+		       aname,
+		       (bdata->output_section->vma
+			+ bdata->output_offset
+			+ isym->st_value),
+		       isymbuf[obj->pos].st_value,
+		       bfd_get_filename(ibfd));
+
+	      /* If this is an input object that is the result of a
+		 relocateable link run, also print the name of the
+		 original file that defined this bit object.  */
+	      if (this_file)
+		this_base = strchr (this_file, '.');
+	      if (this_file
+		  && this_base
+		  && strncmp (this_file, ibfd->filename,
+			      this_base - this_file))
+		fprintf (out, " <%s>", this_file);
+	      fprintf (out, "\n");
 	    }
 
-	  /* Remember that this reloc is going to be changed; see
-	     comment above for details about why this is necessary.  */
-	  reloc_adjusted[sec->id][irel - internal_relocs] = 1;
-	  if (bitoff_seen)
+	  /* Walk through all global symbols in this section.  */
+	  for (i = 0; i < bs->num_globals; ++i)
 	    {
-	      if (tricore_elf32_debug_relax)
-	        printf ("bpos from 0 to %d\n", bpos);
+	      struct elf_link_hash_entry *sym = bs->globals[i].h;
+	      struct elf_link_hash_entry *sym2 = bs->globals[i].pos_h;
+	      const char *aname = sym->root.root.string;
 
-	      irel->r_info = ((irel->r_info & 0xff) | bidx << 8);
-	      irel->r_addend = 0;
-	      lastrel->r_info = R_TRICORE_NONE;
-	      bitoff_seen = false;
-	    }
-	  else
-	    {
-	      if (tricore_elf32_debug_relax)
-	        printf ("addr from %ld to %ld\n", old, new);
+	      if (sym->size != 1)
+		{
+		  (*_bfd_error_handler)
+		   (_("%s: bit symbol \"%s\" has size != 1 (%ld)"),
+		    bfd_get_filename(ibfd), aname, sym->size);
+		  bfd_set_error (bfd_error_bad_value);
+		  continue;
+		}
+
+	      /* The global symbol "aname.pos" should be defined in
+		 section ".boffs" and have type STT_NOTYPE.  */
+	      if ((sym2 == NULL)
+		  || (sym2->root.u.def.section != boffs)
+		  || (sym2->type != STT_NOTYPE))
+		{
+		  (*_bfd_error_handler)
+		   (_("%s: missing or invalid bit position symbol \"%s.pos\""),
+		    bfd_get_filename(ibfd), aname);
+		  bfd_set_error (bfd_error_bad_value);
+		  continue;
+		}
 
-	      irel->r_addend = new;
+	      fprintf (out, "%-19s 0x%08lx.%ld  g   %s\n",
+		       aname,
+		       (bdata->output_section->vma
+			+ bdata->output_offset
+			+ sym->root.u.def.value),
+		       sym2->root.u.def.value,
+		       bfd_get_filename(ibfd));
 	    }
+        }
+    }
+
+  return true;
+}
+
+/* Adjust all relocs that reference a given bit object of the bit
+   section indexed by BSEC: OLD is the former offset of the bit address
+   within this section, NEW is the new offset, BPOS is the new bit
+   position (0..7), and BIDX is the symbol index of the symbol
+   representing that bit offset (i.e., "name.pos" in section ".boffs").  */
+
+static bool
+tricore_elf32_adjust_bit_relocs (bit_section_t *bsec,
+     bfd_vma old,
+     bfd_vma new,
+     int bpos,
+     unsigned long bidx)
+{
+  bit_reloc_t *br, *brend;
+  size_t lo, hi;
+
+  /* If nothing changes, return immediately.  */
+  if ((old == new) && (bpos == 0))
+    return true;
+
+  /* The relocs are sorted by their original addend; find the first one
+     referencing OLD.  */
+  for (lo = 0, hi = bsec->num_relocs; lo < hi; )
+    {
+      size_t mid = lo + (hi - lo) / 2;
+
+      if (bsec->relocs[mid].addend < old)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+
+  brend = bsec->relocs + bsec->num_relocs;
+  for (br = bsec->relocs + lo; br < brend && br->addend == old; ++br)
+    {
+      Elf_Internal_Rela *irel = br->irel;
+
+      /* We must remember which relocations we've already changed, as we
+	 have to avoid modifying the same relocation multiple times.  Why?
+	 Well, consider the following case: first we change a relocation
+	 from, say, .bdata+42 to .bdata+3 (note that it doesn't matter
+	 whether we're also (or merely) changing the bit position); then
+	 another, yet unmodified relocation references .bdata+3, which
+	 should now, after relaxation, be changed into a relocation against
+	 .bdata+7.  Without remembering which relocs we've already changed,
+	 we would again modify the already modified relocation against
+	 .bdata+3 (which was originally against .bdata+42) -- ouch!  */
+      if (br->adjusted)
+	continue;
+
+      if (tricore_elf32_debug_relax)
+	printf ("    %s+%ld: symbol at %s+%ld, changing ",
+		br->sec->name, irel->r_offset, bsec->sec->name,
+		irel->r_addend);
+
+      br->adjusted = true;
+      if (br->bitpos != NULL)
+	{
+	  if (tricore_elf32_debug_relax)
+	    printf ("bpos from 0 to %d\n", bpos);
+
+	  irel->r_info = ((irel->r_info & 0xff) | bidx << 8);
+	  irel->r_addend = 0;
+	  br->bitpos->r_info = R_TRICORE_NONE;
+	}
+      else
+	{
+	  if (tricore_elf32_debug_relax)
+	    printf ("addr from %ld to %ld\n", old, new);
+
+	  irel->r_addend = new;
 	}
     }
 
@@ -5113,30 +5924,33 @@ tricore_elf32_adjust_bit_relocs (bfd *abfd,
    (in section ".boffs") dealing with bit objects.  */
 
 static bool
-tricore_elf32_relax_section_bitobjects(bfd *abfd,
-                                      asection *sec,
-                                      struct bfd_link_info *info,
-                                      bool *again)
+tricore_elf32_relax_section_bitobjects (bfd *abfd,
+					asection *sec,
+					struct bfd_link_info *info,
+					bool *again)
 {
   Elf_Internal_Shdr *symtab_hdr;
   bfd_byte *contents = NULL;
+  bfd_byte *orig_contents = NULL;
   Elf_Internal_Sym *isymbuf = NULL;
+  unsigned char *strtab = NULL;
   bfd_size_type sec_size;
+  bfd_vma baddr = 0;
+  int bpos = -1;
+  asection *boffs;
+  bit_section_t *bs;
+  unsigned int i;
+  bool is_bdata;
 
   if (tricore_elf32_debug_relax)
-  printf("Relaxing %s(%s) [secid = %d], raw = %ld, cooked = %ld\n",
-         bfd_get_filename(abfd), sec->name, sec->id,
-         sec->rawsize, sec->size);
+    printf ("Relaxing %s(%s) [secid = %d], raw = %ld, cooked = %ld\n",
+	    bfd_get_filename (abfd), sec->name, sec->id,
+	    sec->rawsize, sec->size);
 
   /* Assume nothing changes.  */
   *again = false;
 
-  sec_size = bfd_get_section_limit(abfd, sec);
-  contents = retrieve_contents(abfd, sec, info->keep_memory);
-  if (contents == NULL && sec_size != 0)
-  {
-    return false;
-  }
+  sec_size = bfd_get_section_limit (abfd, sec);
 
   /* If this is the first time we've been called for this section,
      initialize its sizes.  */
@@ -5145,303 +5959,239 @@ tricore_elf32_relax_section_bitobjects(bfd *abfd,
   if (sec->rawsize == 0)
     sec->rawsize = sec_size;
 
-  symtab_hdr = &elf_tdata(abfd)->symtab_hdr;
+  symtab_hdr = &elf_tdata (abfd)->symtab_hdr;
 
-  /* If requested, compress bit sections (.b{data,bss}{,.*}).  */
-  if (tricore_elf32_relax_bdata && !bfd_link_relocatable(info) && (sec_size > 0) /* the section contains
-                                                                                    something */
-      && (sec->rawsize == sec->size)                                             /* is not relaxed */
-      && (!strcmp(sec->name, ".bdata") || !strncmp(sec->name, ".bdata.", 7) || !strcmp(sec->name, ".bbss") || !strncmp(sec->name, ".bbss.", 6)))
-  {
-  bfd_vma baddr = 0;
-  int bpos = -1;
-  asection *boffs;
-  Elf_Internal_Shdr *strtab_hdr = NULL;
-  unsigned char *strtab = NULL;
-  unsigned int sec_shndx, boffs_shndx;
-  unsigned int symcount;
-  bfd_byte *orig_contents = NULL;
-  struct elf_link_hash_entry **beg_hashes;
-  struct elf_link_hash_entry **end_hashes;
-  struct elf_link_hash_entry **sym_hashes;
-  bool is_bdata = (sec->name[2] == 'd');
+  /* If requested, compress bit sections (.b{data,bss}{,.*}), unless
+     this section is empty or has already been relaxed.  */
+  if (!tricore_elf32_relax_bdata
+      || bfd_link_relocatable (info)
+      || (sec_size == 0)
+      || (sec->rawsize != sec->size)
+      || !tricore_elf32_bit_section_p (sec->name))
+    return true;
+
+  contents = retrieve_contents (abfd, sec, info->keep_memory);
+  if (contents == NULL && sec_size != 0)
+    return false;
 
-  boffs = bfd_get_section_by_name(abfd, ".boffs");
+  is_bdata = (sec->name[2] == 'd');
+
+  boffs = bfd_get_section_by_name (abfd, ".boffs");
   if (boffs == NULL)
-  {
-      (*_bfd_error_handler)(_("%s: missing section \".boffs\""),
-                            bfd_get_filename(abfd));
-      bfd_set_error(bfd_error_bad_value);
+    {
+      (*_bfd_error_handler) (_("%s: missing section \".boffs\""),
+			     bfd_get_filename (abfd));
+      bfd_set_error (bfd_error_bad_value);
       return false;
-  }
+    }
   if (boffs->rawsize != 0)
-  {
-      (*_bfd_error_handler)(_("%s: section \".boffs\" has non-zero size"),
-                            bfd_get_filename(abfd));
-      bfd_set_error(bfd_error_bad_value);
+    {
+      (*_bfd_error_handler) (_("%s: section \".boffs\" has non-zero size"),
+			     bfd_get_filename (abfd));
+      bfd_set_error (bfd_error_bad_value);
       return false;
-  }
-  sec_shndx = _bfd_elf_section_from_bfd_section(abfd, sec);
-  boffs_shndx = _bfd_elf_section_from_bfd_section(abfd, boffs);
-
-  if (is_bdata)
-  {
-      /* Make a copy of the original data to avoid overwriting
-         them while packing the bit objects.  */
-      orig_contents = bfd_malloc(sec->rawsize);
-      if (orig_contents == NULL)
-        return false;
+    }
 
-      memcpy(orig_contents, contents, sec->rawsize);
-  }
+  if (!tricore_elf32_bit_index (abfd, sec, info, true, &bs))
+    return false;
+  if (bs == NULL)
+    return true;
 
-  /* Read this BFD's local symbols.  */
+  /* Read this BFD's local symbols; they're cached by retrieve_local_syms,
+     as we're going to change their values.  */
   if (symtab_hdr->sh_info != 0)
-  {
-      isymbuf = retrieve_local_syms(abfd);
+    {
+      isymbuf = retrieve_local_syms (abfd);
       if (isymbuf == NULL)
-        return false;
+	return false;
 
-      /* Cache local syms, as we're going to change their values.  */
-      symtab_hdr->contents = (unsigned char *)isymbuf;
+      strtab = retrieve_strtab (abfd);
+      BFD_ASSERT (strtab);
+    }
 
-      strtab_hdr = &elf_tdata(abfd)->strtab_hdr;
-      strtab = strtab_hdr->contents;
-      if (strtab == NULL)
-      {
-        (void)bfd_elf_string_from_elf_section(abfd, symtab_hdr->sh_link, 1);
-        // bfd_elf_get_str_section (abfd, symtab_hdr->sh_link);
-        strtab = strtab_hdr->contents;
-      }
-      BFD_ASSERT(strtab);
-  }
+  if (is_bdata)
+    {
+      /* Make a copy of the original data to avoid overwriting
+	 them while packing the bit objects.  */
+      orig_contents = bfd_malloc (sec->rawsize);
+      if (orig_contents == NULL)
+	return false;
 
-  /* Walk through all local symbols in this section.  */
-  if (isymbuf != NULL)
-  {
-      Elf_Internal_Sym *isym, *isymend = isymbuf + symtab_hdr->sh_info;
+      memcpy (orig_contents, contents, sec->rawsize);
+    }
 
-      for (isym = isymbuf; isym < isymend; isym++)
-      {
-        if ((isym->st_shndx == sec_shndx) && (ELF_ST_TYPE(isym->st_info) == STT_OBJECT))
-        {
-          Elf_Internal_Sym *isym2;
-          char *aname, *pname;
-          size_t len;
+  /* Walk through all local symbols in this section.  */
+  for (i = 0; i < bs->num_locals; ++i)
+    {
+      Elf_Internal_Sym *isym = isymbuf + bs->locals[i].sym;
+      Elf_Internal_Sym *isym2;
+      unsigned char byte = '\0';
+      char *aname, *pname;
 
-          aname = (char *)(strtab + isym->st_name);
-          len = strlen(aname);
-          if (isym->st_size != 1)
-          {
-            /* This symbol no bit.  Gripe.  */
-            (*_bfd_error_handler)(_("%s: bit symbol \"%s\" has size != 1 (%ld)"),
-                                  bfd_get_filename(abfd), aname, isym->st_size);
-            bfd_set_error(bfd_error_bad_value);
-            return false;
-          }
+      aname = (char *) (strtab + isym->st_name);
+      if (isym->st_size != 1)
+	{
+	  /* This symbol no bit.  Gripe.  */
+	  (*_bfd_error_handler) (_("%s: bit symbol \"%s\" has size != 1 (%ld)"),
+				 bfd_get_filename (abfd), aname,
+				 isym->st_size);
+	  bfd_set_error (bfd_error_bad_value);
+	  goto error_return;
+	}
 
-          if (tricore_elf32_debug_relax)
-          {
-          printf("  * %s (local), old addr = %ld",
-                 aname, isym->st_value);
-          fflush(stdout);
-          }
+      if (tricore_elf32_debug_relax)
+	{
+	  printf ("  * %s (local), old addr = %ld", aname, isym->st_value);
+	  fflush (stdout);
+	}
 
-          /* Usually (in case of tricore-as, at least), we expect the
-             next local symbol after a local bit symbol to be a
-             local bit position symbol attached to section ".boffs",
-             but nevertheless we're allowing said bit position
-             symbol to be defined anywhere between the local bit
-             symbol and the end of this object file's local syms.  */
-          for (isym2 = isym + 1; isym2 < isymend; isym2++)
-          {
-          if (ELF_ST_TYPE(isym2->st_info) == STT_FILE)
-          {
-              /* No bit position symbol defined; bail out.  */
-              isym2 = isymend;
-              break;
-          }
+      if (bs->locals[i].pos == (unsigned long) -1)
+	{
+	  if (tricore_elf32_debug_relax)
+	    printf ("\n");
 
-          if ((isym2->st_shndx == boffs_shndx) && (ELF_ST_TYPE(isym2->st_info) == STT_NOTYPE) && (strlen((char *)(strtab + isym2->st_name)) == (len + 4)) && !strncmp(aname, (char *)(strtab + isym2->st_name), len) && !strcmp((char *)(strtab + isym2->st_name + len), ".pos"))
-          {
-              unsigned char byte = '\0';
+	  (*_bfd_error_handler) (_("%s: missing or invalid local bit position "
+				   "symbol \"%s.pos\" in section \".boffs\""),
+				 bfd_get_filename (abfd), aname);
+	  bfd_set_error (bfd_error_bad_value);
+	  goto error_return;
+	}
 
-              pname = (char *)(strtab + isym2->st_name);
-              if (isym2->st_value != 0)
-              {
-                if (tricore_elf32_debug_relax)
-                  printf("\n");
-
-                (*_bfd_error_handler)(_("%s: bit position symbol \"%s\" has "
-                                        "non-zero value %ld"),
-                                      bfd_get_filename(abfd), pname,
-                                      isym2->st_value);
-                bfd_set_error(bfd_error_bad_value);
-                return false;
-              }
+      isym2 = isymbuf + bs->locals[i].pos;
+      pname = (char *) (strtab + isym2->st_name);
+      if (isym2->st_value != 0)
+	{
+	  if (tricore_elf32_debug_relax)
+	    printf ("\n");
 
-              /* Determine next free bit address.  */
-              if (++bpos == 8)
-              {
-            bpos = 0;
-            ++baddr;
-              }
+	  (*_bfd_error_handler) (_("%s: bit position symbol \"%s\" has "
+				   "non-zero value %ld"),
+				 bfd_get_filename (abfd), pname,
+				 isym2->st_value);
+	  bfd_set_error (bfd_error_bad_value);
+	  goto error_return;
+	}
 
-              if (is_bdata)
-              {
-                /* Copy the bit object's original value
-                  to its new bit address.  */
-                byte =
-                    (orig_contents[isym->st_value] & 1) << bpos;
-                contents[baddr] &= ~(1 << bpos);
-                contents[baddr] |= byte;
-              }
+      /* Determine next free bit address.  */
+      if (++bpos == 8)
+	{
+	  bpos = 0;
+	  ++baddr;
+	}
 
-              if (tricore_elf32_debug_relax)
-              {
-                printf(".0, new addr = %ld.%d", baddr, bpos);
-                if (is_bdata)
-                  printf(", val = 0x%02x", byte);
-                printf("\n");
-              }
+      if (is_bdata)
+	{
+	  /* Copy the bit object's original value to its new bit address.  */
+	  byte = (orig_contents[isym->st_value] & 1) << bpos;
+	  contents[baddr] &= ~(1 << bpos);
+	  contents[baddr] |= byte;
+	}
 
-              /* Adjust relocations against the old bit object.  */
-              if (!tricore_elf32_adjust_bit_relocs(abfd, info, sec_shndx, isym->st_value, baddr,
-                                                   bpos, isym2 - isymbuf))
-                return false;
+      if (tricore_elf32_debug_relax)
+	{
+	  printf (".0, new addr = %ld.%d", baddr, bpos);
+	  if (is_bdata)
+	    printf (", val = 0x%02x", byte);
+	  printf ("\n");
+	}
 
-              /* Finally, set the new values.  */
-              isym->st_value = baddr;
-              isym2->st_value = bpos;
-              break;
-          }
-          }
-          if (isym2 == isymend)
-          {
-            if (tricore_elf32_debug_relax)
-                printf("\n");
+      /* Adjust relocations against the old bit object.  */
+      if (!tricore_elf32_adjust_bit_relocs (bs, isym->st_value, baddr, bpos,
+					    bs->locals[i].pos))
+	goto error_return;
 
-            (*_bfd_error_handler)(_("%s: missing or invalid local bit position "
-                                    "symbol \"%s.pos\" in section \".boffs\""),
-                                  bfd_get_filename(abfd), aname);
-            bfd_set_error(bfd_error_bad_value);
-            return false;
-          }
-        }
-      }
-  }
+      /* Finally, set the new values.  */
+      isym->st_value = baddr;
+      isym2->st_value = bpos;
+    }
 
   /* Walk through all global symbols in this section.  */
-  symcount = (symtab_hdr->sh_size / sizeof(Elf32_External_Sym) - symtab_hdr->sh_info);
-  beg_hashes = elf_sym_hashes(abfd);
-  end_hashes = elf_sym_hashes(abfd) + symcount;
-  for (sym_hashes = beg_hashes; sym_hashes < end_hashes; sym_hashes++)
-  {
-      struct elf_link_hash_entry *sym = *sym_hashes;
-
-      if ((sym->root.u.def.section == sec) && (sym->type == STT_OBJECT) && ((sym->root.type == bfd_link_hash_defined) || (sym->root.type == bfd_link_hash_defweak)))
-      {
-        struct elf_link_hash_entry *sym2;
-        const char *aname = sym->root.root.string;
-        char *pname;
-        size_t len;
-
-        if (sym->size != 1)
-        {
-          /* This symbol no bit.  Gripe.  */
-          (*_bfd_error_handler)(_("%s: bit symbol \"%s\" has size != 1 (%ld)"),
-                                bfd_get_filename(abfd), aname, sym->size);
-          bfd_set_error(bfd_error_bad_value);
-          return false;
-        }
-
-        if (tricore_elf32_debug_relax)
-        {
-          printf("  * %s (global), old addr = %ld",
-                 aname, sym->root.u.def.value);
-          fflush(stdout);
-        }
+  for (i = 0; i < bs->num_globals; ++i)
+    {
+      struct elf_link_hash_entry *sym = bs->globals[i].h;
+      struct elf_link_hash_entry *sym2 = bs->globals[i].pos_h;
+      const char *aname = sym->root.root.string;
+      unsigned char byte = '\0';
 
-        len = strlen(aname) + 5;
-        if ((pname = bfd_malloc(len)) == NULL)
-          return false;
+      if (sym->size != 1)
+	{
+	  /* This symbol no bit.  Gripe.  */
+	  (*_bfd_error_handler) (_("%s: bit symbol \"%s\" has size != 1 (%ld)"),
+				 bfd_get_filename (abfd), aname, sym->size);
+	  bfd_set_error (bfd_error_bad_value);
+	  goto error_return;
+	}
 
-        sprintf(pname, "%s.pos", aname);
-        sym2 = (struct elf_link_hash_entry *)
-            bfd_link_hash_lookup(info->hash, pname,
-                                 false, false, false);
-        if ((sym2 == NULL) || (sym2->type != STT_NOTYPE) || (sym2->root.u.def.value != 0) || strcmp(sym2->root.u.def.section->name, ".boffs"))
-        {
-          if (tricore_elf32_debug_relax)
-          printf("\n");
-
-          (*_bfd_error_handler)(_("%s: missing or invalid global bit position "
-                                  "symbol \"%s\""),
-                                bfd_get_filename(abfd), pname);
-          bfd_set_error(bfd_error_bad_value);
-          free(pname);
-          return false;
-        }
-        else
-        {
-          unsigned char byte = '\0';
+      if (tricore_elf32_debug_relax)
+	{
+	  printf ("  * %s (global), old addr = %ld",
+		  aname, sym->root.u.def.value);
+	  fflush (stdout);
+	}
 
-          free(pname);
+      /* The global symbol "aname.pos" must be defined in this object's
+	 section ".boffs".  */
+      if ((sym2 == NULL)
+	  || (sym2->type != STT_NOTYPE)
+	  || (sym2->root.u.def.value != 0)
+	  || strcmp (sym2->root.u.def.section->name, ".boffs")
+	  || (bs->globals[i].pos == (unsigned long) -1))
+	{
+	  if (tricore_elf32_debug_relax)
+	    printf ("\n");
 
-          /* Determine next free bit address.  */
-          if (++bpos == 8)
-          {
-          bpos = 0;
-          ++baddr;
-          }
-          if (is_bdata)
-          {
-          /* Copy the bit object's original value
-             to its new bit address.  */
-          byte = (orig_contents[sym->root.u.def.value] & 1) << bpos;
-          contents[baddr] &= ~(1 << bpos);
-          contents[baddr] |= byte;
-          }
+	  (*_bfd_error_handler) (_("%s: missing or invalid global bit position "
+				   "symbol \"%s.pos\""),
+				 bfd_get_filename (abfd), aname);
+	  bfd_set_error (bfd_error_bad_value);
+	  goto error_return;
+	}
 
-          if (tricore_elf32_debug_relax)
-          {
-          printf(".0, new addr = %ld.%d", baddr, bpos);
-          if (is_bdata)
-              printf(", val = 0x%02x", byte);
-          printf("\n");
-          }
+      /* Determine next free bit address.  */
+      if (++bpos == 8)
+	{
+	  bpos = 0;
+	  ++baddr;
+	}
+      if (is_bdata)
+	{
+	  /* Copy the bit object's original value to its new bit address.  */
+	  byte = (orig_contents[sym->root.u.def.value] & 1) << bpos;
+	  contents[baddr] &= ~(1 << bpos);
+	  contents[baddr] |= byte;
+	}
 
-          /* get the sym index into the elf sym_hashes */
-
-          /* This catches cases in which the assembler (or other
-             binutil) has transformed relocations against "local
-             globals" (i.e., global symbols defined in the same
-             module as the instructions referencing them) into
-             relocations against section+offset, as it is usually
-             only done with relocs against local symbols.  */
-          if (!(tricore_elf32_adjust_bit_relocs(abfd, info, sec_shndx,
-                                                sym->root.u.def.value, baddr, bpos,
-                                                global_sym_index(abfd, sym2))))
-          return false;
-
-          /* Finally, set the new values.  */
-          sym->root.u.def.value = baddr;
-          sym2->root.u.def.value = bpos;
-        }
-      }
-  }
+      if (tricore_elf32_debug_relax)
+	{
+	  printf (".0, new addr = %ld.%d", baddr, bpos);
+	  if (is_bdata)
+	    printf (", val = 0x%02x", byte);
+	  printf ("\n");
+	}
+
+      /* This catches cases in which the assembler (or other binutil)
+	 has transformed relocations against "local globals" (i.e.,
+	 global symbols defined in the same module as the instructions
+	 referencing them) into relocations against section+offset, as
+	 it is usually only done with relocs against local symbols.  */
+      if (!tricore_elf32_adjust_bit_relocs (bs, sym->root.u.def.value,
+					    baddr, bpos, bs->globals[i].pos))
+	goto error_return;
+
+      /* Finally, set the new values.  */
+      sym->root.u.def.value = baddr;
+      sym2->root.u.def.value = bpos;
+    }
 
-  if (sec->rawsize == 0)
-      sec->rawsize = sec->size;
   sec->size = baddr + 1;
-  if (is_bdata && (orig_contents != NULL))
-      free(orig_contents);
+  free (orig_contents);
   if (sec->rawsize != sec->size)
-      *again = true;
+    *again = true;
   return true;
-  }
 
-  return true;
+ error_return:
+  free (orig_contents);
+  return false;
 }
 
 
@@ -5469,17 +6219,9 @@ tricore_elf32_relax_pcrel(bfd *abfd,
   Elf_Internal_Rela *irel, *irelend;
   bfd_byte *contents = NULL;
   Elf_Internal_Sym *isymbuf = NULL;
-  static bool initialized = false;
-  static bool *rela_malloced = NULL;
-  static struct _rela
-  {
-      bfd_vma offset;
-      bfd_vma addend;
-      unsigned long symoff;
-      int size;
-  } **rela_p = NULL;
-  static int *num_rela = NULL, *max_rela = NULL;
-  int now_rela = 0, idx = sec->id;
+  struct tricore_relax_context *ctx = tricore_elf32_relax_ctx (info);
+  pcrel_stubs_t *stubs;
+  int now_rela = 0;
   bfd_size_type sec_size;
 
   if (tricore_elf32_debug_relax)
@@ -5491,11 +6233,6 @@ tricore_elf32_relax_pcrel(bfd *abfd,
   *again = false;
 
   sec_size = bfd_get_section_limit(abfd, sec);
-  contents = retrieve_contents(abfd, sec, info->keep_memory);
-  if (contents == NULL && sec_size != 0)
-  {
-      return false;
-  }
 
   /* If this is the first time we've been called for this section,
      initialize its sizes.  */
@@ -5515,31 +6252,39 @@ tricore_elf32_relax_pcrel(bfd *abfd,
       || (sec->reloc_count == 0))
       return true;
 
-  if (!initialized)
+  contents = retrieve_contents(abfd, sec, info->keep_memory);
+  if (contents == NULL && sec_size != 0)
+  {
+      return false;
+  }
+
+  if (ctx->pcrel == NULL)
   {
-      int i, max = -1;
+      unsigned int i, max = 0;
       bfd *ibfd;
       asection *section;
 
       /* Find the highest section ID of all input sections.  */
       for (ibfd = info->input_bfds; ibfd; ibfd = ibfd->link.next)
         for (section = ibfd->sections; section; section = section->next)
-          if ((int)section->id > max)
+          if (section->id > max)
             max = section->id;
       ++max;
-      if (((rela_malloced = bfd_malloc(max * sizeof(bool))) == NULL) || ((rela_p = bfd_malloc(max * sizeof(struct _rela *))) == NULL) || ((num_rela = bfd_malloc(max * sizeof(int))) == NULL) || ((max_rela = bfd_malloc(max * sizeof(int))) == NULL))
+      ctx->pcrel = (pcrel_stubs_t *) objalloc_alloc (ctx->memory,
+                                                     max * sizeof (pcrel_stubs_t));
+      if (ctx->pcrel == NULL)
         return false;
 
       for (i = 0; i < max; ++i)
       {
-        rela_malloced[i] = false;
-        rela_p[i] = NULL;
-        num_rela[i] = -1;
-        max_rela[i] = 12;
+        ctx->pcrel[i].relocs_malloced = false;
+        ctx->pcrel[i].stubs = NULL;
+        ctx->pcrel[i].num = -1;
+        ctx->pcrel[i].max = 12;
       }
-
-      initialized = true;
+      ctx->num_pcrel = max;
   }
+  stubs = &ctx->pcrel[sec->id];
 
   /* Get a copy of the native relocations.  */
   internal_relocs = retrieve_internal_relocs(abfd, sec, info->keep_memory);
@@ -5641,16 +6386,16 @@ tricore_elf32_relax_pcrel(bfd *abfd,
 
       /* See if we already created a stub for this symbol.  */
       use_offset = sec->size;
-      if (rela_p[idx] != NULL)
+      if (stubs->stubs != NULL)
       {
         int i;
 
-        for (i = 0; i <= num_rela[idx]; ++i)
+        for (i = 0; i <= stubs->num; ++i)
         {
-          if ((rela_p[idx][i].symoff == r_index) && (rela_p[idx][i].addend == irel->r_addend) && (rela_p[idx][i].size == add_bytes))
+          if ((stubs->stubs[i].symoff == r_index) && (stubs->stubs[i].addend == irel->r_addend) && (stubs->stubs[i].size == add_bytes))
           {
             /* Use the existing stub.  */
-            use_offset = rela_p[idx][i].offset;
+            use_offset = stubs->stubs[i].offset;
             diff = use_offset - irel->r_offset;
 
             if (diff > 16777214)
@@ -5724,26 +6469,26 @@ tricore_elf32_relax_pcrel(bfd *abfd,
       bfd_put_32(abfd, 0x02dc0000, contents + sec->size + doff + 8);
 
       /* Remember the new relocs.  */
-      if (num_rela[idx] == -1)
+      if (stubs->num == -1)
       {
-        if ((rela_p[idx] = (struct _rela *)
-          bfd_malloc(max_rela[idx] * sizeof(struct _rela))) == NULL)
+        if ((stubs->stubs = (pcrel_stub_t *)
+          bfd_malloc(stubs->max * sizeof(pcrel_stub_t))) == NULL)
           goto error_return;
-        num_rela[idx] = 0;
+        stubs->num = 0;
       }
-      else if (++num_rela[idx] == max_rela[idx])
+      else if (++stubs->num == stubs->max)
       {
-        max_rela[idx] *= 2;
-        if ((rela_p[idx] = (struct _rela *)
-                bfd_realloc(rela_p[idx],
-                            max_rela[idx] * sizeof(struct _rela))) == NULL)
+        stubs->max *= 2;
+        if ((stubs->stubs = (pcrel_stub_t *)
+                bfd_realloc(stubs->stubs,
+                            stubs->max * sizeof(pcrel_stub_t))) == NULL)
           goto error_return;
       }
       ++now_rela;
-      rela_p[idx][num_rela[idx]].offset = sec->size + doff;
-      rela_p[idx][num_rela[idx]].addend = irel->r_addend;
-      rela_p[idx][num_rela[idx]].symoff = r_index;
-      rela_p[idx][num_rela[idx]].size = add_bytes;
+      stubs->stubs[stubs->num].offset = sec->size + doff;
+      stubs->stubs[stubs->num].addend = irel->r_addend;
+      stubs->stubs[stubs->num].symoff = r_index;
+      stubs->stubs[stubs->num].size = add_bytes;
 
       /* Set the new section size.  */
       sec->size += add_bytes;
@@ -5757,7 +6502,7 @@ tricore_elf32_relax_pcrel(bfd *abfd,
   {
     int i;
 
-    if (info->keep_memory && !rela_malloced[idx])
+    if (info->keep_memory && !stubs->relocs_malloced)
     {
       if ((irel = bfd_malloc((sec->reloc_count + 2 * now_rela) * sizeof(Elf_Internal_Rela))) == NULL)
         goto error_return;
@@ -5770,7 +6515,7 @@ tricore_elf32_relax_pcrel(bfd *abfd,
       memcpy(irel, internal_relocs,
             sec->reloc_count * sizeof(Elf_Internal_Rela));
       internal_relocs = irel;
-      rela_malloced[idx] = true;
+      stubs->relocs_malloced = true;
     }
     else if ((internal_relocs =
                     bfd_realloc(internal_relocs,
@@ -5779,15 +6524,15 @@ tricore_elf32_relax_pcrel(bfd *abfd,
 
     pin_internal_relocs(sec, internal_relocs);
     irel = internal_relocs + sec->reloc_count;
-    for (i = num_rela[idx] - now_rela + 1; i <= num_rela[idx]; ++i, ++irel)
+    for (i = stubs->num - now_rela + 1; i <= stubs->num; ++i, ++irel)
     {
-      irel->r_addend = rela_p[idx][i].addend;
-      irel->r_offset = rela_p[idx][i].offset;
-      irel->r_info = ELF32_R_INFO(rela_p[idx][i].symoff, R_TRICORE_HIADJ);
+      irel->r_addend = stubs->stubs[i].addend;
+      irel->r_offset = stubs->stubs[i].offset;
+      irel->r_info = ELF32_R_INFO(stubs->stubs[i].symoff, R_TRICORE_HIADJ);
       ++irel;
-      irel->r_addend = rela_p[idx][i].addend;
-      irel->r_offset = rela_p[idx][i].offset + 4;
-      irel->r_info = ELF32_R_INFO(rela_p[idx][i].symoff, R_TRICORE_LO2);
+      irel->r_addend = stubs->stubs[i].addend;
+      irel->r_offset = stubs->stubs[i].offset + 4;
+      irel->r_info = ELF32_R_INFO(stubs->stubs[i].symoff, R_TRICORE_LO2);
     }
 
     /* Set the new relocation count.  */
@@ -5815,6 +6560,7 @@ tricore_elf32_relax_init (
      struct bfd_link_info *info,
      bool *again)
 {
+  struct tricore_relax_context *ctx = tricore_elf32_relax_ctx (info);
   Elf_Internal_Shdr *symtab_hdr;
   Elf_Internal_Rela *internal_relocs = NULL;
   Elf_Internal_Rela *irel, *irelend;
@@ -5830,11 +6576,6 @@ tricore_elf32_relax_init (
 
   sym_sec = NULL;
   sec_size = bfd_get_section_limit (abfd,sec);
-  contents = retrieve_contents (abfd, sec, info->keep_memory);
-  if (contents == NULL && sec_size != 0)
-    {
-      return false;
-    }
 
   /* If this is the first time we've been called for this section,
      initialize its sizes.  */
@@ -5856,6 +6597,12 @@ tricore_elf32_relax_init (
         return true;
     }
 
+  contents = retrieve_contents (abfd, sec, info->keep_memory);
+  if (contents == NULL && sec_size != 0)
+    {
+      return false;
+    }
+
   /* Get a copy of the native relocations.  */
   internal_relocs = retrieve_internal_relocs(abfd,sec,info->keep_memory);
   if (internal_relocs == NULL)
@@ -5963,10 +6710,10 @@ tricore_elf32_relax_init (
               (*_bfd_error_handler) (_("error: .callinfo contains a NULL reloc"));
               return false;
             }
-          for (ii=0; ii<callinfo_len; ii++)
+          for (ii=0; ii<ctx->callinfo_len; ii++)
             {
-              if (((callinfo[ii].irel_beg == irel) || (callinfo[ii].irel_end == irel))
-                  && (callinfo[ii].sym_sec == sym_sec) && (callinfo[ii].done == 2))
+              if (((ctx->callinfo[ii].irel_beg == irel) || (ctx->callinfo[ii].irel_end == irel))
+                  && (ctx->callinfo[ii].sym_sec == sym_sec) && (ctx->callinfo[ii].done == 2))
                 {
         	        captured = true;
                   break;
@@ -5994,25 +6741,25 @@ tricore_elf32_relax_init (
           if (irel->r_offset % 0x18 == 0)
             {
               unsigned int *pinfo;
-              memset(&callinfo[callinfo_len], 0, sizeof(callinfo_t));
-              callinfo[callinfo_len].addrbeg = sym_val;
-              callinfo[callinfo_len].bytes = contents + irel->r_offset;
-              pinfo = (unsigned int *) callinfo[callinfo_len].bytes;
-              callinfo[callinfo_len].status = 1;
-              callinfo[callinfo_len].reloc = 0;
-              callinfo[callinfo_len].irel_beg = irel;
-              callinfo[callinfo_len].sym_sec = sym_sec;
-              callinfo[callinfo_len].sec = sec;
-              callinfo[callinfo_len].done = 1;
-              callinfo[callinfo_len].abfd = abfd;
-              callinfo[callinfo_len].info = info;
-              callinfo[callinfo_len].regs_func = pinfo[2];
-              callinfo[callinfo_len].func_status = pinfo[5];
-              callinfo[callinfo_len].regs_total = 0;
-              callinfo[callinfo_len].regs_calls = 0;
+              memset(&ctx->callinfo[ctx->callinfo_len], 0, sizeof(callinfo_t));
+              ctx->callinfo[ctx->callinfo_len].addrbeg = sym_val;
+              ctx->callinfo[ctx->callinfo_len].bytes = contents + irel->r_offset;
+              pinfo = (unsigned int *) ctx->callinfo[ctx->callinfo_len].bytes;
+              ctx->callinfo[ctx->callinfo_len].status = 1;
+              ctx->callinfo[ctx->callinfo_len].reloc = 0;
+              ctx->callinfo[ctx->callinfo_len].irel_beg = irel;
+              ctx->callinfo[ctx->callinfo_len].sym_sec = sym_sec;
+              ctx->callinfo[ctx->callinfo_len].sec = sec;
+              ctx->callinfo[ctx->callinfo_len].done = 1;
+              ctx->callinfo[ctx->callinfo_len].abfd = abfd;
+              ctx->callinfo[ctx->callinfo_len].info = info;
+              ctx->callinfo[ctx->callinfo_len].regs_func = pinfo[2];
+              ctx->callinfo[ctx->callinfo_len].func_status = pinfo[5];
+              ctx->callinfo[ctx->callinfo_len].regs_total = 0;
+              ctx->callinfo[ctx->callinfo_len].regs_calls = 0;
               if ((tricore_elf32_debug_relax) != 0)
                 {
-                printf ("tricore_elf32_relax_section_init1A [%d] callrel24[%d] beg=%8.8x end=%8.8x %d \n",j,callinfo_len,callinfo[callinfo_len].addrbeg,callinfo[callinfo_len].addrend,is_symbol_global);
+                printf ("tricore_elf32_relax_section_init1A [%d] callrel24[%d] beg=%8.8x end=%8.8x %d \n",j,ctx->callinfo_len,ctx->callinfo[ctx->callinfo_len].addrbeg,ctx->callinfo[ctx->callinfo_len].addrend,is_symbol_global);
                 printf ("tricore_elf32_relax_section_init1B [%d] callrel24 sym_val=%8.8lx locglob=%d offset=%8.8lx addend=%8.8lx \n",j,sym_val,is_symbol_global,irel->r_offset,irel->r_addend);
                 }
             }
@@ -6024,30 +6771,30 @@ tricore_elf32_relax_init (
               //do some prechecks, if we have really a vaild callinfo
               //e.g. crtststuff is here strange, begin and end label are seprated by an inline section asm statement
               //so begin must end, referenced symbols as begin and end marker should belong to same section
-              if (callinfo[callinfo_len].sym_sec->id != sym_sec->id) fail = 1;
-              if (callinfo[callinfo_len].addrbeg > sym_val-1) fail = 2;
-              if (callinfo[callinfo_len].done != 1) fail = 3;
+              if (ctx->callinfo[ctx->callinfo_len].sym_sec->id != sym_sec->id) fail = 1;
+              if (ctx->callinfo[ctx->callinfo_len].addrbeg > sym_val-1) fail = 2;
+              if (ctx->callinfo[ctx->callinfo_len].done != 1) fail = 3;
               if (fail != 0)
                 {
                   // Clear the entry
-                  memset(&callinfo[callinfo_len], 0, sizeof(callinfo_t));
+                  memset(&ctx->callinfo[ctx->callinfo_len], 0, sizeof(callinfo_t));
                 }
               else
                 {
-                  callinfo[callinfo_len].irel_end = irel;
-                  callinfo[callinfo_len].addrend = sym_val-1;
-                  callinfo[callinfo_len].done = 2;
+                  ctx->callinfo[ctx->callinfo_len].irel_end = irel;
+                  ctx->callinfo[ctx->callinfo_len].addrend = sym_val-1;
+                  ctx->callinfo[ctx->callinfo_len].done = 2;
                   if (tricore_elf32_debug_relax)
                     {
-                      printf("tricore_elf32_relax_section_init2A [%d] callrel24[%d] beg=%8.8x end=%8.8x %d \n",j,callinfo_len,callinfo[callinfo_len].addrbeg,callinfo[callinfo_len].addrend,is_symbol_global);
+                      printf("tricore_elf32_relax_section_init2A [%d] callrel24[%d] beg=%8.8x end=%8.8x %d \n",j,ctx->callinfo_len,ctx->callinfo[ctx->callinfo_len].addrbeg,ctx->callinfo[ctx->callinfo_len].addrend,is_symbol_global);
                       printf("tricore_elf32_relax_section_init2B [%d] callrel24 sym_val=%8.8lx locglob=%d offset=%8.8lx addend=%8.8lx \n",j,sym_val,is_symbol_global,irel->r_offset,irel->r_addend);
                     }
-                  callinfo_len += 1;
-                  if (callinfo_len == callinfo_len_limit)
+                  ctx->callinfo_len += 1;
+                  if (ctx->callinfo_len == ctx->callinfo_len_limit)
                     {
-                      callinfo_len_limit += CALLINFO_LEN_MAX;
-                      callinfo = (callinfo_t *) bfd_realloc(callinfo, callinfo_len_limit*sizeof(callinfo_t));
-                      if (callinfo == NULL) { abort(); }
+                      ctx->callinfo_len_limit += CALLINFO_LEN_MAX;
+                      ctx->callinfo = (callinfo_t *) bfd_realloc(ctx->callinfo, ctx->callinfo_len_limit*sizeof(callinfo_t));
+                      if (ctx->callinfo == NULL) { abort(); }
                     }
                 }
             }
@@ -6071,33 +6818,83 @@ error_return:
   return false;
 }
 
+static int
+tricore_elf32_callinfo_compare (const void *a, const void *b)
+{
+  const callinfo_key_t *ka = (const callinfo_key_t *) a;
+  const callinfo_key_t *kb = (const callinfo_key_t *) b;
+
+  if (ka->addrbeg != kb->addrbeg)
+    return (ka->addrbeg < kb->addrbeg) ? -1 : 1;
+  return ka->idx - kb->idx;
+}
+
+/* Sort the collected functions by their start address.  */
+
+static bool
+tricore_elf32_callinfo_build_index (struct tricore_relax_context *ctx)
+{
+  ctx->callinfo_sorted = (callinfo_key_t *)
+    objalloc_alloc (ctx->memory, (ctx->callinfo_len + 1) * sizeof (callinfo_key_t));
+  if (ctx->callinfo_sorted == NULL)
+    return false;
+  for (int jj=0; jj<ctx->callinfo_len; jj++)
+    {
+      ctx->callinfo_sorted[jj].addrbeg = ctx->callinfo[jj].addrbeg;
+      ctx->callinfo_sorted[jj].idx = jj;
+    }
+  qsort (ctx->callinfo_sorted, ctx->callinfo_len, sizeof (callinfo_key_t),
+         tricore_elf32_callinfo_compare);
+  return true;
+}
+
+/* Return the position in callinfo_sorted of the first function starting
+   at SYM_VAL, or -1 if there is none.  */
+
+static int
+tricore_elf32_callinfo_lookup (struct tricore_relax_context *ctx,
+                               bfd_vma sym_val)
+{
+  int lo = 0, hi = ctx->callinfo_len, mid;
+
+  while (lo < hi)
+    {
+      mid = lo + (hi - lo) / 2;
+      if (ctx->callinfo_sorted[mid].addrbeg < sym_val)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+  if ((lo < ctx->callinfo_len) && (ctx->callinfo_sorted[lo].addrbeg == sym_val))
+    return lo;
+  return -1;
+}
+
+/* Check the references from section SEC to the functions collected in
+   callinfo.  A function stays a candidate for the fcall/fret optimization
+   only if every reference to it (outside of .callinfo and debug sections)
+   is a 24-bit call marked with a R_TRICORE_RELAX reloc.  Candidates that
+   fail the check get status 0; if SEC can't be analysed at all, all of
+   them do.  */
+
 static bool
 tricore_elf32_relax_status (
      bfd *abfd,
      asection *sec,
-     struct bfd_link_info *info,
-     bool *again,int cidx)
+     struct bfd_link_info *info)
 {
+  struct tricore_relax_context *ctx = tricore_elf32_relax_ctx (info);
   Elf_Internal_Shdr *symtab_hdr;
   Elf_Internal_Rela *internal_relocs = NULL;
   Elf_Internal_Rela *irel, *irelend;
   bfd_byte *contents = NULL;
   Elf_Internal_Sym *isymbuf = NULL;
   asection *sym_sec;
-  bfd_vma sym_val_ref;
-  int j;
   bfd_size_type sec_size;
+  bool check_refs;
 
-  /* Assume nothing changes.  */
-  *again = false;
   sym_sec=NULL;
   sec_size = bfd_get_section_limit(abfd,sec);
-  contents = retrieve_contents (abfd, sec, info->keep_memory);
-  sym_val_ref=callinfo[cidx].addrbeg;
-  if (contents == NULL && sec_size != 0)
-    {
-      return false;
-    }
 
   /* If this is the first time we've been called for this section,
      initialize its sizes.  */
@@ -6112,6 +6909,15 @@ tricore_elf32_relax_status (
       || (sec->reloc_count == 0))
     return true;
 
+  contents = retrieve_contents (abfd, sec, info->keep_memory);
+  if (contents == NULL && sec_size != 0)
+    {
+      goto fail_all;
+    }
+
+  check_refs = ((strcmp (sec->name, ".callinfo") != 0)
+                && (strstr (sec->name, ".debug") == NULL));
+
   /* Get a copy of the native relocations.  */
   internal_relocs = retrieve_internal_relocs(abfd,sec,info->keep_memory);
   if (internal_relocs == NULL)
@@ -6119,13 +6925,14 @@ tricore_elf32_relax_status (
 
   /* Walk through the relocs looking for call/jump targets.  */
   irelend = internal_relocs + sec->reloc_count;
-  j=0;
-  for (irel = internal_relocs; irel < irelend; irel++,j++)
+  for (irel = internal_relocs; irel < irelend; irel++)
     {
       struct elf_link_hash_entry *h;
       bfd_vma sym_val;
       long r_type;
       unsigned long r_index;
+      int pos;
+      bool valid;
       /* Read this BFD's local symbols if we haven't done so already.  */
       if ((isymbuf == NULL) && (symtab_hdr->sh_info != 0))
         {
@@ -6177,16 +6984,21 @@ tricore_elf32_relax_status (
                     + irel->r_addend;
         }
 
-       if ((sym_val==sym_val_ref) && (strcmp (sec->name, ".callinfo")!=0) && (strstr(sec->name, ".debug") == NULL))
-         {
-           Elf_Internal_Rela *irel_relax;
-           if (r_type!=R_TRICORE_24REL) { goto error_return; }
-           irel_relax=irel+1;
-           if (irel_relax>=irelend) { goto error_return; }
-           long r_type_relax = ELF32_R_TYPE (irel_relax->r_info);
-           if (r_type_relax!=R_TRICORE_RELAX) { goto error_return; }
-           if (irel->r_offset!=irel_relax->r_offset) { goto error_return; }
-          }
+       if (!check_refs)
+         continue;
+       pos = tricore_elf32_callinfo_lookup (ctx, sym_val);
+       if (pos < 0)
+         continue;
+
+       valid = (r_type == R_TRICORE_24REL
+                && irel + 1 < irelend
+                && ELF32_R_TYPE (irel[1].r_info) == R_TRICORE_RELAX
+                && irel->r_offset == irel[1].r_offset);
+       if (valid)
+         continue;
+       for (; pos < ctx->callinfo_len
+              && ctx->callinfo_sorted[pos].addrbeg == sym_val; pos++)
+         ctx->callinfo[ctx->callinfo_sorted[pos].idx].status = 0;
     }
 
 
@@ -6199,36 +7011,35 @@ tricore_elf32_relax_status (
 error_return:
   release_internal_relocs(sec,internal_relocs);
   release_contents(sec,contents);
+fail_all:
+  for (int jj=0; jj<ctx->callinfo_len; jj++)
+    ctx->callinfo[jj].status = 0;
   return false;
 }
 
+/* Change the calls in section SEC to all remaining fcall/fret candidates
+   from call to fcall.  If a reference to a candidate can't be changed,
+   the remaining references to it in SEC are left alone.  */
+
 static bool
 tricore_elf32_relax_fcall_func (
      bfd *abfd,
      asection *sec,
-     struct bfd_link_info *info,
-     bool *again,int cidx)
+     struct bfd_link_info *info)
 {
+  struct tricore_relax_context *ctx = tricore_elf32_relax_ctx (info);
   Elf_Internal_Shdr *symtab_hdr;
   Elf_Internal_Rela *internal_relocs = NULL;
   Elf_Internal_Rela *irel, *irelend;
   bfd_byte *contents = NULL;
   Elf_Internal_Sym *isymbuf = NULL;
   asection *sym_sec;
-  bfd_vma sym_val_ref;
-  int j;
   bfd_size_type sec_size;
+  bool check_refs;
 
-  /* Assume nothing changes.  */
-  *again = false;
   sym_sec=NULL;
   sec_size = bfd_get_section_limit(abfd,sec);
-  contents = retrieve_contents (abfd, sec, info->keep_memory);
-  sym_val_ref=callinfo[cidx].addrbeg;
-  if (contents == NULL && sec_size != 0)
-    {
-      return false;
-    }
+
   /* If this is the first time we've been called for this section,
      initialize its sizes.  */
   if (sec->size == 0)
@@ -6242,6 +7053,15 @@ tricore_elf32_relax_fcall_func (
       || (sec->reloc_count == 0))
     return true;
 
+  contents = retrieve_contents (abfd, sec, info->keep_memory);
+  if (contents == NULL && sec_size != 0)
+    {
+      return false;
+    }
+
+  check_refs = ((strcmp (sec->name, ".callinfo") != 0)
+                && (strstr (sec->name, ".debug") == NULL));
+
   /* Get a copy of the native relocations.  */
   internal_relocs = retrieve_internal_relocs(abfd,sec,info->keep_memory);
   if (internal_relocs == NULL)
@@ -6249,8 +7069,7 @@ tricore_elf32_relax_fcall_func (
 
   /* Walk through the relocs looking for call/jump targets.  */
   irelend = internal_relocs + sec->reloc_count;
-  j=0;
-  for (irel = internal_relocs; irel < irelend; irel++,j++)
+  for (irel = internal_relocs; irel < irelend; irel++)
     {
       struct elf_link_hash_entry *h;
       bfd_vma sym_val;
@@ -6309,21 +7128,32 @@ tricore_elf32_relax_fcall_func (
           sym_sec=h->root.u.def.section;
         }
 
-       if ((sym_val==sym_val_ref) && (strcmp (sec->name, ".callinfo")!=0) && (strstr(sec->name, ".debug") == NULL))
+       if (!check_refs)
+         continue;
+       int pos = tricore_elf32_callinfo_lookup (ctx, sym_val);
+       if (pos < 0)
+         continue;
+
+       for (; pos < ctx->callinfo_len
+              && ctx->callinfo_sorted[pos].addrbeg == sym_val; pos++)
          {
+           int cidx = ctx->callinfo_sorted[pos].idx;
            int len32;
            bfd_byte *byte_ptr = NULL;
            unsigned long insn;
 
-           if (r_type!=R_TRICORE_24REL) { goto error_return; }
-
-           Elf_Internal_Rela *irel_relax;
-           irel_relax=irel+1;
-           if (irel_relax>=irelend) { goto error_return; }
-           long r_type_relax = ELF32_R_TYPE (irel_relax->r_info);
-           if (r_type_relax!=R_TRICORE_RELAX) { goto error_return; }
+           if ((ctx->callinfo[cidx].status != 1)
+               || (ctx->callinfo[cidx].fcall_stop_sec == sec))
+             continue;
 
-           if (irel->r_offset!=irel_relax->r_offset) { goto error_return; }
+           if ((r_type != R_TRICORE_24REL)
+               || (irel + 1 >= irelend)
+               || (ELF32_R_TYPE (irel[1].r_info) != R_TRICORE_RELAX)
+               || (irel->r_offset != irel[1].r_offset))
+             {
+               ctx->callinfo[cidx].fcall_stop_sec = sec;
+               continue;
+             }
 
            //Modify now the call //is it call
            byte_ptr = (bfd_byte *) contents + irel->r_offset;
@@ -6334,10 +7164,14 @@ tricore_elf32_relax_fcall_func (
              insn = bfd_get_16 (abfd, byte_ptr);
            if (tricore_elf32_debug_relax)
               printf("CALL -> FCALL Modification insn=%8.8lx addr=%8.8lx \n",insn,sec->output_section->vma + sec->output_offset+irel->r_offset);
-           if (insn!=0x0000006d) { goto error_return; }
+           if (insn!=0x0000006d)
+             {
+               ctx->callinfo[cidx].fcall_stop_sec = sec;
+               continue;
+             }
            insn=0x00000061;
            bfd_put_32 (abfd, insn, byte_ptr);
-          }
+         }
     }
 
   /* Free or cache the memory we've allocated for relocs, local symbols,
@@ -6352,14 +7186,15 @@ error_return:
   return false;
 }
 
-static int tricore_elf32_callinfo (bfd_vma sym_val)
+static int tricore_elf32_callinfo (struct tricore_relax_context *ctx,
+                                   bfd_vma sym_val)
 {
+  int pos;
 
-  for (int jj=0; jj<callinfo_len; jj++ )
-    {
-      if (callinfo[jj].addrbeg==sym_val) return jj;
-    }
-  return -1;
+  pos = tricore_elf32_callinfo_lookup (ctx, sym_val);
+  if (pos < 0)
+    return -1;
+  return ctx->callinfo_sorted[pos].idx;
 }
 
 static int tricore_disass_opcode(opcode_info_t *opcode_info)
@@ -9922,6 +10757,7 @@ error_return:
 
 static int tricore_elf32_relax_rename (struct bfd_link_info *info, int cidx, int from, int to)
 {
+  struct tricore_relax_context *ctx = tricore_elf32_relax_ctx (info);
   //print the disassembly
   asection *sym_sec;
   int func_start;
@@ -9932,11 +10768,11 @@ static int tricore_elf32_relax_rename (struct bfd_link_info *info, int cidx, int
   opcode_info_t *opcode=NULL;
   int opcode_error;
   int insn_cnt;
-  sym_sec=callinfo[cidx].sym_sec;
-  func_start= callinfo[cidx].addrbeg - (sym_sec->output_section->vma + sym_sec->output_offset);
-  func_end= callinfo[cidx].addrend - (sym_sec->output_section->vma + sym_sec->output_offset);
+  sym_sec=ctx->callinfo[cidx].sym_sec;
+  func_start= ctx->callinfo[cidx].addrbeg - (sym_sec->output_section->vma + sym_sec->output_offset);
+  func_end= ctx->callinfo[cidx].addrend - (sym_sec->output_section->vma + sym_sec->output_offset);
   bfd_byte *contents = NULL;
-  contents = retrieve_contents (callinfo[cidx].abfd, sym_sec, info->keep_memory);
+  contents = retrieve_contents (ctx->callinfo[cidx].abfd, sym_sec, info->keep_memory);
 
   //an initial test, that the function does not contain crazy opcodes etc
   //this can happen, e.g. data is defined inside this section or an illegal opcode is used to generate traps etc.
@@ -9966,11 +10802,11 @@ static int tricore_elf32_relax_rename (struct bfd_link_info *info, int cidx, int
       len32 = (contents[offs] & 1);
       if (len32)
         {
-          insn=bfd_get_32 (callinfo[cidx].abfd, &contents[offs]);;
+          insn=bfd_get_32 (ctx->callinfo[cidx].abfd, &contents[offs]);;
         }
       else
         {
-          insn=bfd_get_16 (callinfo[cidx].abfd, &contents[offs]);;
+          insn=bfd_get_16 (ctx->callinfo[cidx].abfd, &contents[offs]);;
         }
       opcode_s = &opcode[insn_cnt];
       opcode_s->current_pc = sym_sec->output_section->vma
@@ -10079,20 +10915,20 @@ static int tricore_elf32_relax_rename (struct bfd_link_info *info, int cidx, int
       len32 = (contents[offs] & 1);
       if (len32)
         {
-          insn = bfd_get_32 (callinfo[cidx].abfd, &contents[offs]);;
+          insn = bfd_get_32 (ctx->callinfo[cidx].abfd, &contents[offs]);;
         }
       else
         {
-          insn = bfd_get_16 (callinfo[cidx].abfd, &contents[offs]);;
+          insn = bfd_get_16 (ctx->callinfo[cidx].abfd, &contents[offs]);;
         }
       if (tricore_elf32_debug_relax) printf ("Rewrite asm ASM%8.8lx %8.8lx %8.8lx\n",opcode_s->current_pc,insn,opcode_s->insn);
       if (len32)
         {
-          bfd_put_32 (callinfo[cidx].abfd, opcode_s->insn, &contents[offs]);;
+          bfd_put_32 (ctx->callinfo[cidx].abfd, opcode_s->insn, &contents[offs]);;
         }
       else
         {
-          bfd_put_16 (callinfo[cidx].abfd, opcode_s->insn, &contents[offs]);;
+          bfd_put_16 (ctx->callinfo[cidx].abfd, opcode_s->insn, &contents[offs]);;
         }
       if (len32) { offs+=4; insn_cnt+=1; } else { offs+=2; insn_cnt+=1; }
     }
@@ -10115,6 +10951,7 @@ tricore_elf32_relax_regs (
      struct bfd_link_info *info,
      bool *again,int cidx)
 {
+  struct tricore_relax_context *ctx = tricore_elf32_relax_ctx (info);
   Elf_Internal_Shdr *symtab_hdr;
   Elf_Internal_Rela *internal_relocs = NULL;
   Elf_Internal_Rela *irel, *irel_prev, *irelend;
@@ -10138,8 +10975,8 @@ tricore_elf32_relax_regs (
   sec_size = bfd_get_section_limit (abfd,sec);
   contents = retrieve_contents (abfd, sec, info->keep_memory);
   sym_val_prev = 0;
-  sym_val_ref_beg = callinfo[cidx].addrbeg;
-  sym_val_ref_end = callinfo[cidx].addrend;
+  sym_val_ref_beg = ctx->callinfo[cidx].addrbeg;
+  sym_val_ref_end = ctx->callinfo[cidx].addrend;
   if (contents == NULL)
     {
       return false;
@@ -10282,7 +11119,7 @@ tricore_elf32_relax_regs (
 
            // check if the function is known to .callinfo
            int func_callinfo_status;
-           func_callinfo_status=tricore_elf32_callinfo(sym_val_prev);
+           func_callinfo_status=tricore_elf32_callinfo (ctx, sym_val_prev);
            if (func_callinfo_status == -1)
              {
                //function not known at all;
@@ -10291,15 +11128,16 @@ tricore_elf32_relax_regs (
              }
            else
              {
-               if (callinfo[func_callinfo_status].done == 3)
+               if (ctx->callinfo[func_callinfo_status].done == 3)
                  {
                    // the values are known
-                   regs_used |= callinfo[func_callinfo_status].regs_total;
+                   regs_used |= ctx->callinfo[func_callinfo_status].regs_total;
                    continue;
                  }
                else
                  {
                    // the values are not known, we can go for worst case or wait till it is getting resolved
+                   ctx->callinfo[cidx].blocked_by = func_callinfo_status;
                    *again = true;
                    goto ok_return;
                  }
@@ -10312,7 +11150,7 @@ tricore_elf32_relax_regs (
 
   if (tricore_elf32_debug_relax)
     {
-      printf ("Update done of addr=%8.8x %d->%d\n", callinfo[cidx].addrbeg, callinfo[cidx].done, 3);
+      printf ("Update done of addr=%8.8x %d->%d\n", ctx->callinfo[cidx].addrbeg, ctx->callinfo[cidx].done, 3);
       // now a renaming of regs_func would be possible, to be still a fcall candidate
       // upper registers are used in regs_used
       if (regs_used & 0xF000FF00)
@@ -10320,10 +11158,10 @@ tricore_elf32_relax_regs (
           printf ("regs_used in using upper register\n");
         }
       //tell me the amout of upper a registers and uppder d registers
-      printf ("Amount of upper A regs used by function body %d\n",__builtin_popcount(callinfo[cidx].regs_func & 0xF0000000));
-      printf ("Amount of upper D regs used by function body %d\n",__builtin_popcount(callinfo[cidx].regs_func & 0x0000FF00));
-      printf ("Amount of lower A regs used by function body %d\n",__builtin_popcount(callinfo[cidx].regs_func & 0x00FC0000));
-      printf ("Amount of lower D regs used by function body %d\n",__builtin_popcount(callinfo[cidx].regs_func & 0x000000FF));
+      printf ("Amount of upper A regs used by function body %d\n",__builtin_popcount(ctx->callinfo[cidx].regs_func & 0xF0000000));
+      printf ("Amount of upper D regs used by function body %d\n",__builtin_popcount(ctx->callinfo[cidx].regs_func & 0x0000FF00));
+      printf ("Amount of lower A regs used by function body %d\n",__builtin_popcount(ctx->callinfo[cidx].regs_func & 0x00FC0000));
+      printf ("Amount of lower D regs used by function body %d\n",__builtin_popcount(ctx->callinfo[cidx].regs_func & 0x000000FF));
       printf ("Amount of lower A regs used by calls %d\n",__builtin_popcount(regs_used & 0x00FC0000));
       printf ("Amount of lower D regs used by calls %d\n",__builtin_popcount(regs_used & 0x000000FF));
     }
@@ -10333,13 +11171,13 @@ tricore_elf32_relax_regs (
   int renaming;
   renaming = 0;
 
-  if (__builtin_popcount (callinfo[cidx].regs_func & 0x80000000) == 0) //not for A15 upto now
+  if (__builtin_popcount (ctx->callinfo[cidx].regs_func & 0x80000000) == 0) //not for A15 upto now
     {
       // Lower registers in use
       unsigned int lower_used;
-      lower_used = (regs_used | callinfo[cidx].regs_func) & 0x00FC0000;
+      lower_used = (regs_used | ctx->callinfo[cidx].regs_func) & 0x00FC0000;
 
-      if ((__builtin_popcount (callinfo[cidx].regs_func & 0xF0000000) + __builtin_popcount (lower_used)) <= 6)
+      if ((__builtin_popcount (ctx->callinfo[cidx].regs_func & 0xF0000000) + __builtin_popcount (lower_used)) <= 6)
         {
         if (tricore_elf32_debug_relax) printf ("A Registers can be merged\n");
           renaming |= 1;
@@ -10347,23 +11185,23 @@ tricore_elf32_relax_regs (
       else
         {
           if (tricore_elf32_debug_relax) printf ("A Registers can not be merged\n");
-          callinfo[cidx].status = 0;
+          ctx->callinfo[cidx].status = 0;
           goto finalize;
         }
     }
   else
     {
       if (tricore_elf32_debug_relax) printf("A15 Registers can not be merged\n");
-      callinfo[cidx].status = 0;
+      ctx->callinfo[cidx].status = 0;
       goto finalize;
     }
 
-  if (__builtin_popcount (callinfo[cidx].regs_func & 0x00008000) == 0) //not for d15 upto now
+  if (__builtin_popcount (ctx->callinfo[cidx].regs_func & 0x00008000) == 0) //not for d15 upto now
     {
       // Lower registers in use
       unsigned int lower_used;
-      lower_used = (regs_used | callinfo[cidx].regs_func) & 0x000000FF;
-      if ((__builtin_popcount (callinfo[cidx].regs_func & 0x0000FF00) + __builtin_popcount(lower_used)) <= 8)
+      lower_used = (regs_used | ctx->callinfo[cidx].regs_func) & 0x000000FF;
+      if ((__builtin_popcount (ctx->callinfo[cidx].regs_func & 0x0000FF00) + __builtin_popcount(lower_used)) <= 8)
         {
 	        if (tricore_elf32_debug_relax) printf ("D Registers can be merged\n");
            renaming|=2;
@@ -10371,26 +11209,26 @@ tricore_elf32_relax_regs (
       else
         {
           if (tricore_elf32_debug_relax) printf ("D Registers can not be merged\n");
-          callinfo[cidx].status = 0;
+          ctx->callinfo[cidx].status = 0;
           goto finalize;
         }
     }
   else
     {
       if (tricore_elf32_debug_relax) printf ("D15 Registers can not be merged\n");
-      callinfo[cidx].status = 0;
+      ctx->callinfo[cidx].status = 0;
       goto finalize;
     }
 
   // Perform an initial copy to rollback in case something fails
-  sym_sec_mod = callinfo[cidx].sym_sec;
-  func_start = callinfo[cidx].addrbeg - (sym_sec_mod->output_section->vma + sym_sec_mod->output_offset);
-  func_end = callinfo[cidx].addrend - (sym_sec_mod->output_section->vma + sym_sec_mod->output_offset);
+  sym_sec_mod = ctx->callinfo[cidx].sym_sec;
+  func_start = ctx->callinfo[cidx].addrbeg - (sym_sec_mod->output_section->vma + sym_sec_mod->output_offset);
+  func_end = ctx->callinfo[cidx].addrend - (sym_sec_mod->output_section->vma + sym_sec_mod->output_offset);
 
   bfd_byte *contents_copy;
   callinfo_t callinfo_copy;
-  callinfo_copy=callinfo[cidx]; //do a backup
-  contents_copy=(bfd_byte *) bfd_malloc((func_end-func_start+1)*sizeof(bfd_byte));
+  callinfo_copy=ctx->callinfo[cidx]; //do a backup
+  contents_copy=(bfd_byte *) objalloc_alloc (ctx->memory, (func_end-func_start+1)*sizeof(bfd_byte));
   if (contents_copy==NULL)
     {
       abort();
@@ -10400,10 +11238,10 @@ tricore_elf32_relax_regs (
   if (renaming & 1)
     {
       // Check for candidates
-      unsigned int temp_regs_func = callinfo[cidx].regs_func & 0xF0000000;
+      unsigned int temp_regs_func = ctx->callinfo[cidx].regs_func & 0xF0000000;
       unsigned int temp_regs_used = regs_used & 0x00FC0000;
       if (tricore_elf32_debug_relax)
-        printf("Renaming possible for A registers regs_used=%8.8x temp_regs_func=%8.8x temp_regs_used=%8.8x callinfo[cidx].regs_func=%8.8x\n",regs_used,temp_regs_func,temp_regs_used,callinfo[cidx].regs_func);
+        printf("Renaming possible for A registers regs_used=%8.8x temp_regs_func=%8.8x temp_regs_used=%8.8x ctx->callinfo[cidx].regs_func=%8.8x\n",regs_used,temp_regs_func,temp_regs_used,ctx->callinfo[cidx].regs_func);
       // A registers
       for (int jj=(12+16); jj<(16+16); jj++)
         {
@@ -10412,7 +11250,7 @@ tricore_elf32_relax_regs (
               for (int kk=(2+16); kk<(8+16); kk+=1)
                 {
                   //check if there is a free register, should not be used in calls and also not in the function body
-                  if (((temp_regs_used & (1<<kk)) == 0) && ((callinfo[cidx].regs_func & (1<<kk)) == 0))
+                  if (((temp_regs_used & (1<<kk)) == 0) && ((ctx->callinfo[cidx].regs_func & (1<<kk)) == 0))
                     {
                       if (tricore_elf32_debug_relax) printf ("Replace Register A%d by A%d\n",jj-16,kk-16);
                       temp_regs_used |=  (1<<kk);
@@ -10423,13 +11261,13 @@ tricore_elf32_relax_regs (
                       if (renaming_fail)
                         {
                           if (tricore_elf32_debug_relax)
-                            printf ("Renaming failed for A registers regs_used=%8.8x temp_regs_func=%8.8x temp_regs_used=%8.8x callinfo[cidx].regs_func=%8.8x\n",regs_used,temp_regs_func,temp_regs_used,callinfo[cidx].regs_func);
+                            printf ("Renaming failed for A registers regs_used=%8.8x temp_regs_func=%8.8x temp_regs_used=%8.8x ctx->callinfo[cidx].regs_func=%8.8x\n",regs_used,temp_regs_func,temp_regs_used,ctx->callinfo[cidx].regs_func);
                           if ((tricore_elf32_disass_report)!=0)
-                            printf ("Renaming failed for A registers regs_used=%8.8x temp_regs_func=%8.8x temp_regs_used=%8.8x callinfo[cidx].regs_func=%8.8x\n",regs_used,temp_regs_func,temp_regs_used,callinfo[cidx].regs_func);
+                            printf ("Renaming failed for A registers regs_used=%8.8x temp_regs_func=%8.8x temp_regs_used=%8.8x ctx->callinfo[cidx].regs_func=%8.8x\n",regs_used,temp_regs_func,temp_regs_used,ctx->callinfo[cidx].regs_func);
                           goto error_return;
                         }
-                      callinfo[cidx].regs_func &= ~(1<<jj);
-                      callinfo[cidx].regs_func |=  (1<<kk);
+                      ctx->callinfo[cidx].regs_func &= ~(1<<jj);
+                      ctx->callinfo[cidx].regs_func |=  (1<<kk);
                       break;
                     }
                 }
@@ -10439,10 +11277,10 @@ tricore_elf32_relax_regs (
   if (renaming & 2)
     {
       // Check for candidates
-      unsigned int temp_regs_func=callinfo[cidx].regs_func & 0x0000FF00;
+      unsigned int temp_regs_func=ctx->callinfo[cidx].regs_func & 0x0000FF00;
       unsigned int temp_regs_used=regs_used & 0x000000FF;
       if (tricore_elf32_debug_relax)
-        printf ("Renaming possible for D registers regs_used=%8.8x temp_regs_func=%8.8x temp_regs_used=%8.8x callinfo[cidx].regs_func=%8.8x\n",regs_used,temp_regs_func,temp_regs_used,callinfo[cidx].regs_func);
+        printf ("Renaming possible for D registers regs_used=%8.8x temp_regs_func=%8.8x temp_regs_used=%8.8x ctx->callinfo[cidx].regs_func=%8.8x\n",regs_used,temp_regs_func,temp_regs_used,ctx->callinfo[cidx].regs_func);
       // A registers
       for (int jj=8; jj<16; jj++)
         {
@@ -10451,7 +11289,7 @@ tricore_elf32_relax_regs (
               for (int kk=0; kk<8; kk+=1)
                 {
                   // check if there is a free register, should not be used in calls and also not in the function body
-                  if (((temp_regs_used & (1<<kk)) == 0) && ((callinfo[cidx].regs_func & (1<<kk)) == 0))
+                  if (((temp_regs_used & (1<<kk)) == 0) && ((ctx->callinfo[cidx].regs_func & (1<<kk)) == 0))
                     {
                       if (tricore_elf32_debug_relax)
                         printf ("Replace Register D%d by D%d\n",jj,kk);
@@ -10463,13 +11301,13 @@ tricore_elf32_relax_regs (
                       if (renaming_fail)
                         {
                           if (tricore_elf32_debug_relax)
-                            printf ("Renaming failed for D registers regs_used=%8.8x temp_regs_func=%8.8x temp_regs_used=%8.8x callinfo[cidx].regs_func=%8.8x\n",regs_used,temp_regs_func,temp_regs_used,callinfo[cidx].regs_func);
+                            printf ("Renaming failed for D registers regs_used=%8.8x temp_regs_func=%8.8x temp_regs_used=%8.8x ctx->callinfo[cidx].regs_func=%8.8x\n",regs_used,temp_regs_func,temp_regs_used,ctx->callinfo[cidx].regs_func);
                           if (tricore_elf32_disass_report)
-                            printf ("Renaming failed for D registers regs_used=%8.8x temp_regs_func=%8.8x temp_regs_used=%8.8x callinfo[cidx].regs_func=%8.8x\n",regs_used,temp_regs_func,temp_regs_used,callinfo[cidx].regs_func);
+                            printf ("Renaming failed for D registers regs_used=%8.8x temp_regs_func=%8.8x temp_regs_used=%8.8x ctx->callinfo[cidx].regs_func=%8.8x\n",regs_used,temp_regs_func,temp_regs_used,ctx->callinfo[cidx].regs_func);
                           goto error_return;
                         }
-                      callinfo[cidx].regs_func &= ~(1<<jj);
-                      callinfo[cidx].regs_func |=  (1<<kk);
+                      ctx->callinfo[cidx].regs_func &= ~(1<<jj);
+                      ctx->callinfo[cidx].regs_func |=  (1<<kk);
                       break;
                     }
                 }
@@ -10478,9 +11316,9 @@ tricore_elf32_relax_regs (
     }
 
 finalize:
-  callinfo[cidx].done = 3; //if we reach here everything is done
-  callinfo[cidx].regs_calls = regs_used;
-  callinfo[cidx].regs_total = regs_used | callinfo[cidx].regs_func;
+  ctx->callinfo[cidx].done = 3; //if we reach here everything is done
+  ctx->callinfo[cidx].regs_calls = regs_used;
+  ctx->callinfo[cidx].regs_total = regs_used | ctx->callinfo[cidx].regs_func;
 
 ok_return:
   /* Free or cache the memory we've allocated for relocs, local symbols,
@@ -10490,11 +11328,11 @@ ok_return:
   return true;
 
 error_return:
-  callinfo[cidx] = callinfo_copy;
-  callinfo[cidx].done = 3;
-  callinfo[cidx].status = 0;
-  callinfo[cidx].regs_calls = regs_used;
-  callinfo[cidx].regs_total = regs_used | callinfo[cidx].regs_func;
+  ctx->callinfo[cidx] = callinfo_copy;
+  ctx->callinfo[cidx].done = 3;
+  ctx->callinfo[cidx].status = 0;
+  ctx->callinfo[cidx].regs_calls = regs_used;
+  ctx->callinfo[cidx].regs_total = regs_used | ctx->callinfo[cidx].regs_func;
   if(func_end != 0)
     memcpy (&contents[func_start], &contents_copy[0], func_end-func_start+1); //restore
   release_internal_relocs (sec,internal_relocs);
@@ -10510,6 +11348,7 @@ tricore_elf32_relax_fret_func (
      struct bfd_link_info *info,
      bool *again,int cidx)
 {
+  struct tricore_relax_context *ctx = tricore_elf32_relax_ctx (info);
   Elf_Internal_Shdr *symtab_hdr;
   Elf_Internal_Rela *internal_relocs = NULL;
   Elf_Internal_Rela *irel, *irelend;
@@ -10525,13 +11364,8 @@ tricore_elf32_relax_fret_func (
   *again = false;
   sym_sec=NULL;
   sec_size = bfd_get_section_limit (abfd,sec);
-  contents = retrieve_contents (abfd, sec, info->keep_memory);
-  sym_val_ref_beg=callinfo[cidx].addrbeg;
-  sym_val_ref_end=callinfo[cidx].addrend;
-  if (contents == NULL && sec_size != 0)
-    {
-      return false;
-    }
+  sym_val_ref_beg=ctx->callinfo[cidx].addrbeg;
+  sym_val_ref_end=ctx->callinfo[cidx].addrend;
 
   /* If this is the first time we've been called for this section,
      initialize its sizes.  */
@@ -10546,6 +11380,12 @@ tricore_elf32_relax_fret_func (
       || (sec->reloc_count == 0))
     return true;
 
+  contents = retrieve_contents (abfd, sec, info->keep_memory);
+  if (contents == NULL && sec_size != 0)
+    {
+      return false;
+    }
+
   /* Get a copy of the native relocations.  */
   internal_relocs = retrieve_internal_relocs(abfd,sec,info->keep_memory);
   if (internal_relocs == NULL)
@@ -10664,20 +11504,31 @@ error_return:
   return false;
 }
 
-static void
+/* Work out which functions the fcall/fret optimization can be applied
+   to.  Return FALSE if memory runs out.  */
+
+static bool
 tricore_elf32_relax_section_prep (struct bfd_link_info *info)
 {
+  struct tricore_relax_context *ctx = tricore_elf32_relax_ctx (info);
   unsigned int *callinfo_word;
   bfd *ibfd;
   asection *bdata;
-  int cnt, cnt_prev;
+  int *queue, head, tail;
+  long start_time;
+
+  if (!tricore_elf32_callinfo_build_index (ctx))
+    {
+      bfd_set_error (bfd_error_no_memory);
+      return false;
+    }
 
   // Set status to 0 if the function should not be considered based on GCC information
-  for (int jj=0; jj<callinfo_len; jj++)
+  for (int jj=0; jj<ctx->callinfo_len; jj++)
     {
-      if (callinfo[jj].status != 0)
+      if (ctx->callinfo[jj].status != 0)
         {
-          callinfo_word = (unsigned int *) &callinfo[jj].bytes[0];
+          callinfo_word = (unsigned int *) &ctx->callinfo[jj].bytes[0];
           unsigned int val = callinfo_word[5];
           if ((val & FUNC_CFUN_CALLS_ALLOCA)
               || (val & FUNC_CFUN_CALLS_SETJMP)
@@ -10692,46 +11543,83 @@ tricore_elf32_relax_section_prep (struct bfd_link_info *info)
               || (val & FUNC_CTRL_OUTGOING_ARGS)
               || (val & FUNC_STDARG))
             {
-              callinfo[jj].done = 3;
-              callinfo[jj].status = 0;
-              callinfo[jj].regs_total = 0x00FC00FF;
+              ctx->callinfo[jj].done = 3;
+              ctx->callinfo[jj].status = 0;
+              ctx->callinfo[jj].regs_total = 0x00FC00FF;
             }
         }
     }
 
-  // Visit multiple times all the functions in callinfo until all of them reach done level 3
-  cnt_prev = -1;
-  while (1)
+  // Analyse the functions in callinfo until all of them reach done level 3.
+  // A function can only be analysed when all the functions it calls are
+  // done; tricore_elf32_relax_regs tells which callee blocked it, so the
+  // function is parked on that callee and revisited once the callee is
+  // done, instead of sweeping over all functions until nothing changes.
+  // Functions which are part of a call cycle are never completed.
+  start_time = get_run_time ();
+  queue = (int *) objalloc_alloc (ctx->memory, (ctx->callinfo_len + 1) * sizeof (int));
+  if (queue == NULL)
+    {
+      bfd_set_error (bfd_error_no_memory);
+      return false;
+    }
+  head = tail = 0;
+  for (int jj=0; jj<ctx->callinfo_len; jj++)
     {
-          cnt = 0;
-          for (int jj=0; jj<callinfo_len; jj++)
+      ctx->callinfo[jj].waiters = -1;
+      ctx->callinfo[jj].next_waiter = -1;
+      if ((ctx->callinfo[jj].done != 3) && (ctx->callinfo[jj].status != 0))
+        queue[tail++] = jj;
+    }
+  while (head != tail)
+    {
+      int jj = queue[head];
+      bool again;
+
+      head = (head + 1) % (ctx->callinfo_len + 1);
+      if ((ctx->callinfo[jj].done == 3) || (ctx->callinfo[jj].status == 0))
+        continue;
+      // If all func calls inside are in a defined state done will be set to 3, and regs is on final stage
+      ctx->regs_visits++;
+      tricore_elf32_relax_regs (ctx->callinfo[jj].abfd, ctx->callinfo[jj].sym_sec, info, &again, jj);
+      if (again)
+        {
+          int callee = ctx->callinfo[jj].blocked_by;
+          ctx->callinfo[jj].next_waiter = ctx->callinfo[callee].waiters;
+          ctx->callinfo[callee].waiters = jj;
+        }
+      else if (ctx->callinfo[jj].done == 3)
+        {
+          // Wake up the functions waiting for this one, in callinfo order
+          int waiter, prev = -1;
+          for (waiter = ctx->callinfo[jj].waiters; waiter != -1; )
             {
-              callinfo_word = (unsigned int *) &callinfo[jj].bytes[0];
-              if ((callinfo[jj].done != 3) && (callinfo[jj].status != 0))
-                {
-                  bool again;
-                  callinfo_word = (unsigned int *) &callinfo[jj].bytes[0];
-                  // If all func calls inside are in a defined state done will be set to 3, and regs is on final stage
-                  tricore_elf32_relax_regs (callinfo[jj].abfd, callinfo[jj].sym_sec, info, &again, jj);
-                  if (again) cnt += 1;;
-                }
+              int next = ctx->callinfo[waiter].next_waiter;
+              ctx->callinfo[waiter].next_waiter = prev;
+              prev = waiter;
+              waiter = next;
+            }
+          for (waiter = prev; waiter != -1; waiter = ctx->callinfo[waiter].next_waiter)
+            {
+              queue[tail] = waiter;
+              tail = (tail + 1) % (ctx->callinfo_len + 1);
             }
-      if (cnt == 0) break;
-      if (cnt == cnt_prev) break;
-      cnt_prev = cnt;
+          ctx->callinfo[jj].waiters = -1;
+        }
     }
+  ctx->time_regs += get_run_time () - start_time;
 
-  for (int jj=0; jj<callinfo_len; jj++)
+  for (int jj=0; jj<ctx->callinfo_len; jj++)
     {
-      if ((callinfo[jj].regs_total & 0xFB00FF00) != 0) callinfo[jj].status = 0; //A10 is sometimes set, but not used
+      if ((ctx->callinfo[jj].regs_total & 0xFB00FF00) != 0) ctx->callinfo[jj].status = 0; //A10 is sometimes set, but not used
     }
 
-  for (int jj=0; jj<callinfo_len; jj++)
+  for (int jj=0; jj<ctx->callinfo_len; jj++)
     {
-      callinfo_word=(unsigned int *) &callinfo[jj].bytes[0];
+      callinfo_word=(unsigned int *) &ctx->callinfo[jj].bytes[0];
       // further invest in a function e.g. is using only a few lower regs but some upper, mark them for renaming option
       // the work afterwards for such candidates is harder, check subfunction calls, sumit up, till function is flat towards all register usages
-      if (callinfo[jj].status == 0)
+      if (ctx->callinfo[jj].status == 0)
       {
           int regs_used_d_low;
           int regs_used_d_high;
@@ -10751,65 +11639,54 @@ tricore_elf32_relax_section_prep (struct bfd_link_info *info)
           if (renaming)
             {
               if (tricore_elf32_debug_relax)
-                printf ("Function for renaming %8.8x regs=%8.8x status=%8.8x \n",callinfo[jj].addrbeg,callinfo_word[2],callinfo_word[5]);
+                printf ("Function for renaming %8.8x regs=%8.8x status=%8.8x \n",ctx->callinfo[jj].addrbeg,callinfo_word[2],callinfo_word[5]);
             }
       }
     }
 
   // does somebody referencing to the function, indication for pointer usage....
-  for (int jj=0; jj<callinfo_len; jj++)
+  // all sections are checked once against all candidates
+  start_time = get_run_time ();
+  for (ibfd = info->input_bfds; ibfd; ibfd = ibfd->link.next)
     {
-      if (callinfo[jj].status!=0)
+      for (bdata = ibfd->sections; bdata; bdata = bdata->next)
         {
-          for (ibfd = info->input_bfds; ibfd; ibfd = ibfd->link.next)
-            {
-              for (bdata = ibfd->sections; bdata; bdata = bdata->next)
-                {
-                  bool again;
-                  if (tricore_elf32_relax_status (ibfd, bdata, info, &again, jj) == false)
-                    {
-                      callinfo[jj].status = 0;
-                    }
-                }
-            }
+          tricore_elf32_relax_status (ibfd, bdata, info);
         }
     }
-
+  ctx->time_status += get_run_time () - start_time;
+  return true;
 }
 
 static void
 tricore_elf32_relax_fcallfret (struct bfd_link_info *info)
 {
+  struct tricore_relax_context *ctx = tricore_elf32_relax_ctx (info);
   bfd *ibfd;
   asection *bdata;
+  long start_time = get_run_time ();
 
   // adapt the fcalls, walk over all sections, and change call to fcall
-  for (int jj=0; jj<callinfo_len; jj++)
+  for (ibfd = info->input_bfds; ibfd; ibfd = ibfd->link.next)
     {
-      if (callinfo[jj].status == 1)
+      for (bdata = ibfd->sections; bdata; bdata = bdata->next)
         {
-          for (ibfd = info->input_bfds; ibfd; ibfd = ibfd->link.next)
-            {
-              for (bdata = ibfd->sections; bdata; bdata = bdata->next)
-                {
-                  bool again;
-                  tricore_elf32_relax_fcall_func (ibfd, bdata, info, &again,jj);
-                }
-            }
+          tricore_elf32_relax_fcall_func (ibfd, bdata, info);
         }
     }
 
   // adapt the frets, the referenced section is callinfo[jj].sym_sec pointing to the code of the func, where ret->fret transformation will be done
   // also tail calls will be done, callxxx+ret-> jumpxxx
-  for (int jj=0; jj<callinfo_len; jj++ )
+  for (int jj=0; jj<ctx->callinfo_len; jj++ )
     {
-      if (callinfo[jj].status == 1)
+      if (ctx->callinfo[jj].status == 1)
         {
               bool again;
-              tricore_elf32_relax_fret_func (callinfo[jj].abfd, callinfo[jj].sym_sec, info, &again,jj);
+              tricore_elf32_relax_fret_func (ctx->callinfo[jj].abfd, ctx->callinfo[jj].sym_sec, info, &again,jj);
         }
     }
 
+  ctx->time_fcallfret += get_run_time () - start_time;
 }
 
 static bool
@@ -10821,21 +11698,25 @@ tricore_elf32_relax_section(
 {
 
   bool result;
-  static bool init_done = false;
-  static bool stat_callinfo;
-  static bool fcallfret_callinfo;
-  if (init_done == false)
+  struct tricore_relax_context *ctx = tricore_elf32_relax_ctx (info);
+
+  /* Relaxing relies on the TriCore linker hash table.  */
+  if (ctx == NULL)
     {
-      callinfo_len = 0;
-      callinfo_len_limit = CALLINFO_LEN_MAX;
-      callinfo = (callinfo_t *) bfd_malloc (CALLINFO_LEN_MAX * sizeof(callinfo_t));
-      if (callinfo == NULL)
-        {
-          abort ();
-        }
-      init_done = true;
-      stat_callinfo = true;
-      fcallfret_callinfo = true;
+      *again = false;
+      return true;
+    }
+
+  if (ctx->init_done == false)
+    {
+      ctx->callinfo_len = 0;
+      ctx->callinfo_len_limit = CALLINFO_LEN_MAX;
+      ctx->callinfo = (callinfo_t *) bfd_malloc (CALLINFO_LEN_MAX * sizeof(callinfo_t));
+      if (ctx->callinfo == NULL)
+        return false;
+      ctx->init_done = true;
+      ctx->stat_callinfo = true;
+      ctx->fcallfret_callinfo = true;
     }
   result = true;
 
@@ -10852,61 +11733,71 @@ tricore_elf32_relax_section(
       // initialize in pass 0 the callinfo information
       if (info->relax_pass == 0)
         {
+          long start_time = get_run_time ();
           result = tricore_elf32_relax_init (abfd, sec, info, again);
+          ctx->time_init += get_run_time () - start_time;
         }
 
-      if ((info->relax_pass == 1) && (stat_callinfo == true))
+      if ((info->relax_pass == 1) && (ctx->stat_callinfo == true))
         {
           // do prepwork for optimization, identify and exclude functions
           if (tricore_elf32_callinfo_report)
             {
               printf ("Status of Callinfo Initial\n");
               unsigned int *callinfo_word;
-              for (int jj = 0; jj < callinfo_len; jj++)
+              for (int jj = 0; jj < ctx->callinfo_len; jj++)
                 {
-                  callinfo_word = (unsigned int *)&callinfo[jj].bytes[0];
+                  callinfo_word = (unsigned int *)&ctx->callinfo[jj].bytes[0];
                   printf ("Callinfo[%3d] %8.8lx beg=%8.8x end=%8.8x regt=%8.8x regf=%8.8x regc=%8.8x arg=%8.8x ret=%8.8x stat=%8.8x istat=%d done=%d\n",
-                         jj, callinfo[jj].sec->output_section->vma + callinfo[jj].sec->output_offset + callinfo[jj].irel_beg->r_addend,
-                         callinfo[jj].addrbeg, callinfo[jj].addrend,
-                         callinfo[jj].regs_total, callinfo[jj].regs_func, callinfo[jj].regs_calls, callinfo_word[3], callinfo_word[4], callinfo[jj].func_status, callinfo[jj].status, callinfo[jj].done);
+                         jj, ctx->callinfo[jj].sec->output_section->vma + ctx->callinfo[jj].sec->output_offset + ctx->callinfo[jj].irel_beg->r_addend,
+                         ctx->callinfo[jj].addrbeg, ctx->callinfo[jj].addrend,
+                         ctx->callinfo[jj].regs_total, ctx->callinfo[jj].regs_func, ctx->callinfo[jj].regs_calls, callinfo_word[3], callinfo_word[4], ctx->callinfo[jj].func_status, ctx->callinfo[jj].status, ctx->callinfo[jj].done);
                 }
             }
 
-          tricore_elf32_relax_section_prep (info);
+          if (!tricore_elf32_relax_section_prep (info))
+            return false;
 
           if (tricore_elf32_callinfo_report)
             {
               printf("Status of Callinfo After Preperation\n");
               unsigned int *callinfo_word;
-              for (int jj = 0; jj < callinfo_len; jj++)
+              for (int jj = 0; jj < ctx->callinfo_len; jj++)
                 {
-                  callinfo_word = (unsigned int *)&callinfo[jj].bytes[0];
+                  callinfo_word = (unsigned int *)&ctx->callinfo[jj].bytes[0];
                   printf("Callinfo[%3d] %8.8lx beg=%8.8x end=%8.8x regt=%8.8x regf=%8.8x regc=%8.8x arg=%8.8x ret=%8.8x stat=%8.8x istat=%d done=%d\n",
-                        jj, callinfo[jj].sec->output_section->vma + callinfo[jj].sec->output_offset + callinfo[jj].irel_beg->r_addend,
-                        callinfo[jj].addrbeg, callinfo[jj].addrend,
-                        callinfo[jj].regs_total, callinfo[jj].regs_func, callinfo[jj].regs_calls, callinfo_word[3], callinfo_word[4], callinfo[jj].func_status, callinfo[jj].status, callinfo[jj].done);
+                        jj, ctx->callinfo[jj].sec->output_section->vma + ctx->callinfo[jj].sec->output_offset + ctx->callinfo[jj].irel_beg->r_addend,
+                        ctx->callinfo[jj].addrbeg, ctx->callinfo[jj].addrend,
+                        ctx->callinfo[jj].regs_total, ctx->callinfo[jj].regs_func, ctx->callinfo[jj].regs_calls, callinfo_word[3], callinfo_word[4], ctx->callinfo[jj].func_status, ctx->callinfo[jj].status, ctx->callinfo[jj].done);
                 }
             }
-          stat_callinfo = false;
+          ctx->stat_callinfo = false;
         }
 
-      if ((info->relax_pass == 2) && (fcallfret_callinfo == true))
+      if ((info->relax_pass == 2) && (ctx->fcallfret_callinfo == true))
         {
           tricore_elf32_relax_fcallfret (info);
           if (tricore_elf32_callinfo_report)
             {
               printf("Status of Callinfo after fcall/fret optimization\n");
               unsigned int *callinfo_word;
-              for (int jj = 0; jj < callinfo_len; jj++)
+              for (int jj = 0; jj < ctx->callinfo_len; jj++)
                 {
-                  callinfo_word = (unsigned int *)&callinfo[jj].bytes[0];
+                  callinfo_word = (unsigned int *)&ctx->callinfo[jj].bytes[0];
                   printf ("Callinfo[%3d] %8.8lx beg=%8.8x end=%8.8x regt=%8.8x regf=%8.8x regc=%8.8x arg=%8.8x ret=%8.8x stat=%8.8x istat=%d done=%d\n",
-                           jj, callinfo[jj].sec->output_section->vma + callinfo[jj].sec->output_offset + callinfo[jj].irel_beg->r_addend,
-                           callinfo[jj].addrbeg, callinfo[jj].addrend,
-                           callinfo[jj].regs_total, callinfo[jj].regs_func, callinfo[jj].regs_calls, callinfo_word[3], callinfo_word[4], callinfo[jj].func_status, callinfo[jj].status, callinfo[jj].done);
+                           jj, ctx->callinfo[jj].sec->output_section->vma + ctx->callinfo[jj].sec->output_offset + ctx->callinfo[jj].irel_beg->r_addend,
+                           ctx->callinfo[jj].addrbeg, ctx->callinfo[jj].addrend,
+                           ctx->callinfo[jj].regs_total, ctx->callinfo[jj].regs_func, ctx->callinfo[jj].regs_calls, callinfo_word[3], callinfo_word[4], ctx->callinfo[jj].func_status, ctx->callinfo[jj].status, ctx->callinfo[jj].done);
                 }
+              printf ("Callinfo timing: functions=%d init=%ld.%06lds regs=%ld.%06lds (%lu visits) status=%ld.%06lds fcall/fret=%ld.%06lds\n",
+                      ctx->callinfo_len,
+                      ctx->time_init / 1000000, ctx->time_init % 1000000,
+                      ctx->time_regs / 1000000, ctx->time_regs % 1000000,
+                      ctx->regs_visits,
+                      ctx->time_status / 1000000, ctx->time_status % 1000000,
+                      ctx->time_fcallfret / 1000000, ctx->time_fcallfret % 1000000);
             }
-          fcallfret_callinfo = false;
+          ctx->fcallfret_callinfo = false;
         }
     }
 
@@ -10974,18 +11865,105 @@ tricore_elf32_get_sec_type_attr (bfd *abfd ATTRIBUTE_UNUSED, asection *sec)
 }
 
 
+/* Initialize TABLE, one of the symbol tables kept besides the linker
+   hash table.  _bfd_elf_link_hash_table_init can't be used for these,
+   since it makes TABLE the linker hash table of the output BFD.  */
+static bool
+tricore_elf32_symbol_hash_init (struct elf_link_hash_table *table,
+				struct bfd_hash_entry *(*newfunc)
+				  (struct bfd_hash_entry *,
+				   struct bfd_hash_table *, const char *),
+				unsigned int entsize)
+{
+  memset (table, 0, sizeof (*table));
+  table->root.type = bfd_link_elf_hash_table;
+  table->hash_table_id = TRICORE_ELF_DATA;
+  return bfd_hash_table_init (&table->root.table, newfunc, entsize);
+}
+
+/* Release TABLE, set up by tricore_elf32_symbol_hash_init.  */
+static void
+tricore_elf32_symbol_hash_free (struct elf_link_hash_table *table)
+{
+  if (table->root.table.memory != NULL)
+    bfd_hash_table_free (&table->root.table);
+}
+
 /* create different hash tables for imported and exported symbols */
 static struct bfd_link_hash_table *
 tricore_elf32_link_hash_table_create(bfd *abfd)
 {
-    if (!_bfd_elf_link_hash_table_init (&export_hash,
-			    abfd,
-			    _bfd_elf_link_hash_newfunc,
-	                     sizeof(struct elf_link_hash_entry), TRICORE_ELF_DATA))
-      return NULL;
-    if (!tricore_elf32_call_symbol_hash_create(abfd))
+    struct tricore_elf32_link_hash_table *ret;
+
+    ret = (struct tricore_elf32_link_hash_table *) bfd_zmalloc (sizeof (*ret));
+    if (ret == NULL)
       return NULL;
-    return _bfd_elf_link_hash_table_create(abfd);
+    if (!_bfd_elf_link_hash_table_init (&ret->elf, abfd,
+                                        _bfd_elf_link_hash_newfunc,
+                                        sizeof (struct elf_link_hash_entry),
+                                        TRICORE_ELF_DATA))
+      {
+        free (ret);
+        return NULL;
+      }
+    /* Make tricore_elf32_link_hash_table_free able to release RET.  */
+    abfd->link.hash = &ret->elf.root;
+    ret->elf.root.hash_table_free = tricore_elf32_link_hash_table_free;
+
+    if (!tricore_elf32_symbol_hash_init (&ret->export_hash,
+					 _bfd_elf_link_hash_newfunc,
+					 sizeof (struct elf_link_hash_entry))
+	|| !tricore_elf32_call_symbol_hash_create (ret))
+      {
+        tricore_elf32_link_hash_table_free (abfd);
+        return NULL;
+      }
+
+    ret->relax.memory = objalloc_create ();
+    if (ret->relax.memory == NULL)
+      {
+        tricore_elf32_link_hash_table_free (abfd);
+        return NULL;
+      }
+    return &ret->elf.root;
+}
+
+/* Release the relaxation state of a link.  */
+static void
+tricore_elf32_relax_ctx_free (struct tricore_relax_context *ctx)
+{
+  unsigned int i;
+
+  if (ctx->pcrel != NULL)
+    for (i = 0; i < ctx->num_pcrel; i++)
+      free (ctx->pcrel[i].stubs);
+  free (ctx->callinfo);
+  if (ctx->memory != NULL)
+    objalloc_free (ctx->memory);
+  memset (ctx, 0, sizeof (*ctx));
+}
+
+/* Destroy a TriCore ELF linker hash table.  */
+static void
+tricore_elf32_link_hash_table_free (bfd *obfd)
+{
+  struct tricore_elf32_link_hash_table *htab
+    = (struct tricore_elf32_link_hash_table *) obfd->link.hash;
+
+  tricore_elf32_relax_ctx_free (&htab->relax);
+  tricore_elf32_memory_map_free_index (htab);
+  tricore_elf32_memory_map_free ();
+  tricore_elf32_free_core_aliases ();
+  tricore_elf32_symbol_hash_free (&htab->export_hash);
+  if (htab->caller_hash.root.table.memory != NULL)
+    bfd_link_hash_traverse (&htab->caller_hash.root,
+			    tricore_elf32_free_call_symbol, NULL);
+  tricore_elf32_symbol_hash_free (&htab->caller_hash);
+  if (htab->callee_hash.root.table.memory != NULL)
+    bfd_link_hash_traverse (&htab->callee_hash.root,
+			    tricore_elf32_free_call_symbol, NULL);
+  tricore_elf32_symbol_hash_free (&htab->callee_hash);
+  _bfd_elf_link_hash_table_free (obfd);
 }
 
 /* handle __caller.<func>/__callee.<func> symbols
@@ -11015,9 +11993,6 @@ struct tricore_elf_callee_hash_table
 #define CALLER    7
 
 
-static struct tricore_elf_callee_hash_table caller_hash;
-static struct tricore_elf_callee_hash_table callee_hash;
-
 /* create a new hash entry for the caller/callee symbol */
 static struct bfd_hash_entry *
 tricore_elf32_callee_hash_new (struct bfd_hash_entry *entry,
@@ -11040,20 +12015,39 @@ tricore_elf32_callee_hash_new (struct bfd_hash_entry *entry,
   return entry;
 }
 static bool
-tricore_elf32_call_symbol_hash_create (bfd *abfd)
+tricore_elf32_call_symbol_hash_create (struct tricore_elf32_link_hash_table *htab)
 {
-    if (!_bfd_elf_link_hash_table_init (&caller_hash.elf, abfd, tricore_elf32_callee_hash_new,
-                sizeof(struct tricore_elf_callee_hash_table), TRICORE_ELF_DATA))
+    if (!tricore_elf32_symbol_hash_init (&htab->caller_hash,
+					 tricore_elf32_callee_hash_new,
+					 sizeof (struct tricore_elf_callee_hash_table)))
         return false;
-    if (!_bfd_elf_link_hash_table_init (&callee_hash.elf, abfd, tricore_elf32_callee_hash_new,
-                sizeof(struct tricore_elf_callee_hash_table), TRICORE_ELF_DATA))
+    if (!tricore_elf32_symbol_hash_init (&htab->callee_hash,
+					 tricore_elf32_callee_hash_new,
+					 sizeof (struct tricore_elf_callee_hash_table)))
         return false;
     return true;
 }
 
-/* called from tricore_elf32_add_symbol_hook to add name to the hash table */
-static void
-tricore_elf32_add_call_symbol (const char *name)
+/* Release the strings of a caller/callee symbol.  */
+static bool
+tricore_elf32_free_call_symbol (struct bfd_link_hash_entry *entry,
+				void *parm ATTRIBUTE_UNUSED)
+{
+  struct tricore_elf_callee_hash_table *e
+    = (struct tricore_elf_callee_hash_table *) entry;
+
+  free ((char *) e->func_name);
+  free ((char *) e->func_model);
+  free ((char *) e->func_return);
+  free ((char *) e->func_param);
+  return true;
+}
+
+/* called from tricore_elf32_add_symbol_hook to add name to the hash table
+   of HTAB; return FALSE if it can't be added.  */
+static bool
+tricore_elf32_add_call_symbol (struct tricore_elf32_link_hash_table *htab,
+			       const char *name)
 {
   struct elf_link_hash_entry *h;
   struct elf_link_hash_table *hash;
@@ -11065,21 +12059,21 @@ tricore_elf32_add_call_symbol (const char *name)
     {
       /* hash the full name for caller */
       func_name = (char *)name;
-      hash = &caller_hash.elf;
+      hash = &htab->caller_hash;
     }
   else if (strncmp(name,"__callee.",9) == 0)
     {
       /* hash the stripped name for callee */
       dot = strchr (&name[FUNC_NAME], '.');
       func_name = xstrndup (name, dot - name);
-      hash = &callee_hash.elf;
+      hash = &htab->callee_hash;
     }
   else
-    return;
+    return true;
 
   h  = elf_link_hash_lookup (hash, func_name,true,false,false);
   if (h == NULL)
-    return ;
+    return false;
   h->root.type = bfd_link_hash_defined;
   h->root.u.def.section = bfd_abs_section_ptr;
   h->root.u.def.value = 0;
@@ -11104,17 +12098,24 @@ tricore_elf32_add_call_symbol (const char *name)
   tricore_elf_hash_entry(h)->func_return = xstrndup (dot+1, dot2 - dot - 1);
   dot = dot2;
   tricore_elf_hash_entry(h)->func_param = xstrdup (dot+1);
-
+  return true;
 }
 
-/* set to false if a callee does not match the caller */
-static bool tricore_callee_caller;
+/* Information passed to tricore_elf32_check_caller_symbol.  */
+struct tricore_call_symbol_check
+{
+  struct tricore_elf32_link_hash_table *htab;
+  /* Set to false if a callee does not match the caller.  */
+  bool ok;
+};
 
 /* callback too traverse through all caller symbols
    and lookup the corresponding callee symbol */
 static bool
-tricore_elf32_check_caller_symbol (struct bfd_link_hash_entry *entry , void * parm ATTRIBUTE_UNUSED)
+tricore_elf32_check_caller_symbol (struct bfd_link_hash_entry *entry , void * parm)
 {
+  struct tricore_call_symbol_check *check
+    = (struct tricore_call_symbol_check *) parm;
   struct elf_link_hash_entry *hr = (struct elf_link_hash_entry *) entry;
   struct elf_link_hash_entry *he;
   struct tricore_elf_callee_hash_table *callee_entry;
@@ -11129,7 +12130,7 @@ tricore_elf32_check_caller_symbol (struct bfd_link_hash_entry *entry , void * pa
   dot = strchr(&callee[FUNC_NAME],'.');
   *dot = 0;
 
-  he  = elf_link_hash_lookup(&callee_hash.elf,callee ,false,false,false);
+  he  = elf_link_hash_lookup(&check->htab->callee_hash,callee ,false,false,false);
   if (he == NULL)
     {
       /* check for callee with return type 'void' */
@@ -11150,7 +12151,7 @@ tricore_elf32_check_caller_symbol (struct bfd_link_hash_entry *entry , void * pa
                              callee_entry->func_return,
                              callee_entry->func_param,
                              hr->root.root.string);
-      tricore_callee_caller = false;
+      check->ok = false;
     }
   if (strcmp(callee_entry->func_return,caller_entry->func_return)
       && (caller_entry->func_return[0] != 'v'))
@@ -11163,7 +12164,7 @@ tricore_elf32_check_caller_symbol (struct bfd_link_hash_entry *entry , void * pa
                              callee_entry->func_param,
                              hr->root.root.string);
       if (!stack_model)
-        tricore_callee_caller = false;
+        check->ok = false;
     }
   if (strcmp(callee_entry->func_param,caller_entry->func_param))
     {
@@ -11175,7 +12176,7 @@ tricore_elf32_check_caller_symbol (struct bfd_link_hash_entry *entry , void * pa
                              callee_entry->func_param,
                              hr->root.root.string);
       if (!stack_model)
-        tricore_callee_caller = false;
+        check->ok = false;
     }
 
   free(callee);
@@ -11184,21 +12185,36 @@ tricore_elf32_check_caller_symbol (struct bfd_link_hash_entry *entry , void * pa
 
 /* check for all callee/caller pairs, traverse through all caller symbols */
 static bool
-tricore_elf32_check_caller_callee (bfd *abfd, struct bfd_link_info *info ATTRIBUTE_UNUSED)
+tricore_elf32_check_caller_callee (bfd *abfd ATTRIBUTE_UNUSED,
+				   struct bfd_link_info *info)
 {
-  tricore_callee_caller = true;
+  struct tricore_call_symbol_check check;
+
+  check.htab = tricore_elf32_hash_table (info);
+  check.ok = true;
+  if (check.htab == NULL)
+    return true;
 
-  bfd_link_hash_traverse ((struct bfd_link_hash_table *)&caller_hash.elf, tricore_elf32_check_caller_symbol, (void *) abfd);
+  bfd_link_hash_traverse (&check.htab->caller_hash.root,
+			  tricore_elf32_check_caller_symbol, &check);
 
-  return tricore_callee_caller;
+  return check.ok;
 }
 
 static bool
 tricore_elf32_final_link (bfd *abfd, struct bfd_link_info *info)
 {
   /* Invoke the regular ELF backend linker to do all the work.  */
-  if (!bfd_elf_final_link (abfd, info))
+  bool result = bfd_elf_final_link (abfd, info);
+  struct tricore_relax_context *ctx = tricore_elf32_relax_ctx (info);
+
+  /* Relaxing is finished; drop its state.  */
+  if (ctx != NULL)
+    tricore_elf32_relax_ctx_free (ctx);
+  if (!result)
     return false;
+  if (tricore_elf32_stats)
+    tricore_elf32_print_memory_map_stats (info, stderr);
   /* do the callee/caller checking */
   return tricore_elf32_check_caller_callee(abfd,info);
 }
@@ -11232,16 +12248,6 @@ tricore_elf32_relax_hiadj (bfd *abfd,
   Elf_Internal_Rela *irel, *irelend, *irelnext;
   bfd_byte *contents = NULL;
   Elf_Internal_Sym *isymbuf = NULL;
-  static bool initialized = false;
-  static bool *rela_malloced = NULL;
-  static struct _rela
-  {
-      bfd_vma offset;
-      bfd_vma addend;
-      unsigned long symoff;
-      int size;
-  } **rela_p = NULL;
-  static int *num_rela = NULL, *max_rela = NULL;
   bfd_size_type sec_size;
 
   if (tricore_elf32_debug_relax)
@@ -11253,11 +12259,6 @@ tricore_elf32_relax_hiadj (bfd *abfd,
   *again = false;
 
   sec_size = bfd_get_section_limit(abfd, sec);
-  contents = retrieve_contents(abfd, sec, info->keep_memory);
-  if (contents == NULL && sec_size != 0)
-  {
-      return false;
-  }
 
   /* If this is the first time we've been called for this section,
      initialize its sizes.  */
@@ -11270,35 +12271,16 @@ tricore_elf32_relax_hiadj (bfd *abfd,
 
   /* If requested, check whether all call and jump instructions can reach
      their respective target addresses.  We don't have to do anything for a
-     relocateable link, or if this section doesn't contain code or relocs.  */
+     relocateable link, or if this section doesn't contain code or relocs.
+     Check this before reading the contents, so that sections we leave
+     alone are not cached and can be copied from the mapped input file.  */
   if (bfd_link_relocatable(info) || ((sec->flags & SEC_CODE) == 0) || ((sec->flags & SEC_RELOC) == 0) || (sec->reloc_count == 0))
       return true;
 
-  if (!initialized)
+  contents = retrieve_contents(abfd, sec, info->keep_memory);
+  if (contents == NULL && sec_size != 0)
   {
-      int i, max = -1;
-      bfd *ibfd;
-      asection *section;
-
-      /* Find the highest section ID of all input sections.  */
-      for (ibfd = info->input_bfds; ibfd; ibfd = ibfd->link.next)
-        for (section = ibfd->sections; section; section = section->next)
-        if ((int)section->id > max)
-          max = section->id;
-
-      ++max;
-      if (((rela_malloced = bfd_malloc(max * sizeof(bool))) == NULL) || ((rela_p = bfd_malloc(max * sizeof(struct _rela *))) == NULL) || ((num_rela = bfd_malloc(max * sizeof(int))) == NULL) || ((max_rela = bfd_malloc(max * sizeof(int))) == NULL))
-        return false;
-
-      for (i = 0; i < max; ++i)
-      {
-        rela_malloced[i] = false;
-        rela_p[i] = NULL;
-        num_rela[i] = -1;
-        max_rela[i] = 12;
-      }
-
-      initialized = true;
+      return false;
   }
 
   /* Get a copy of the native relocations.  */
@@ -5957,6 +5957,214 @@ _bfd_elf_archive_symbol_lookup (bfd *abfd,
   return h;
 }
 
+/* After the first pass over an archive map, elf_link_add_archive_symbols
+   only probes the entries that might now pull in their member.  This
+   hash table maps each name that _bfd_elf_archive_symbol_lookup may
+   look up for an archive map entry to the entries concerned.  */
+
+struct elf_archive_index_ref
+{
+  struct elf_archive_index_ref *next;
+  symindex indx;
+};
+
+struct elf_archive_index_entry
+{
+  struct bfd_hash_entry root;
+  struct elf_archive_index_ref *refs;
+};
+
+/* State for the passes after the first over an archive map.  */
+
+struct elf_archive_scan
+{
+  struct bfd_hash_table index;
+  /* Entries to probe in the current pass, as a binary min-heap so
+     that they are probed in archive map order.  */
+  symindex *heap;
+  symindex nheap;
+  /* Entries whose last probe found an undefined symbol from a
+     discarded section, a common or a weak undefined symbol.  These
+     may need their member later without any new undefined symbol
+     appearing, so are probed again on every pass.  */
+  symindex *recheck;
+  symindex nrecheck;
+  /* The pass in which each entry was last queued.  */
+  unsigned int *queued;
+  unsigned int pass;
+};
+
+static struct bfd_hash_entry *
+elf_archive_index_newfunc (struct bfd_hash_entry *entry,
+			   struct bfd_hash_table *table,
+			   const char *string)
+{
+  if (entry == NULL)
+    entry = (struct bfd_hash_entry *)
+      bfd_hash_allocate (table, sizeof (struct elf_archive_index_entry));
+  if (entry == NULL)
+    return NULL;
+
+  entry = bfd_hash_newfunc (entry, table, string);
+  if (entry != NULL)
+    ((struct elf_archive_index_entry *) entry)->refs = NULL;
+  return entry;
+}
+
+static bool
+elf_archive_index_add (struct bfd_hash_table *index, const char *name,
+		       bool copy, symindex indx)
+{
+  struct elf_archive_index_entry *ent;
+  struct elf_archive_index_ref *ref;
+
+  ent = (struct elf_archive_index_entry *)
+    bfd_hash_lookup (index, name, true, copy);
+  if (ent == NULL)
+    return false;
+  ref = (struct elf_archive_index_ref *)
+    bfd_hash_allocate (index, sizeof (*ref));
+  if (ref == NULL)
+    return false;
+  ref->indx = indx;
+  ref->next = ent->refs;
+  ent->refs = ref;
+  return true;
+}
+
+static void
+elf_archive_scan_free (struct elf_archive_scan *scan)
+{
+  bfd_hash_table_free (&scan->index);
+  free (scan->heap);
+  free (scan->queued);
+}
+
+/* Set up SCAN for the C entries of archive map SYMDEFS.  */
+
+static bool
+elf_archive_scan_init (struct elf_archive_scan *scan,
+		       carsym *symdefs, symindex c)
+{
+  symindex i;
+
+  scan->heap = (symindex *) bfd_malloc (c * sizeof (*scan->heap));
+  scan->queued = (unsigned int *) bfd_zmalloc (c * sizeof (*scan->queued));
+  if (scan->heap == NULL
+      || scan->queued == NULL
+      || !bfd_hash_table_init (&scan->index, elf_archive_index_newfunc,
+			       sizeof (struct elf_archive_index_entry)))
+    {
+      free (scan->heap);
+      free (scan->queued);
+      return false;
+    }
+  scan->nheap = 0;
+  scan->pass = 0;
+
+  for (i = 0; i < c; i++)
+    {
+      const char *name = symdefs[i].name;
+      const char *p;
+
+      if (!elf_archive_index_add (&scan->index, name, false, i))
+	goto error_return;
+
+      /* A default version also satisfies references with only one
+	 `@' and without the version.  */
+      p = strchr (name, ELF_VER_CHR);
+      if (p != NULL && p[1] == ELF_VER_CHR)
+	{
+	  size_t len = strlen (name);
+	  size_t first = p - name + 1;
+	  char *copy = (char *) bfd_malloc (len);
+	  bool ok;
+
+	  if (copy == NULL)
+	    goto error_return;
+	  memcpy (copy, name, first);
+	  memcpy (copy + first, name + first + 1, len - first);
+	  ok = elf_archive_index_add (&scan->index, copy, true, i);
+	  copy[first - 1] = '\0';
+	  ok = ok && elf_archive_index_add (&scan->index, copy, true, i);
+	  free (copy);
+	  if (!ok)
+	    goto error_return;
+	}
+    }
+  return true;
+
+ error_return:
+  elf_archive_scan_free (scan);
+  return false;
+}
+
+static void
+elf_archive_scan_push (struct elf_archive_scan *scan, symindex indx)
+{
+  symindex *heap = scan->heap;
+  symindex k = scan->nheap++;
+
+  while (k > 0 && heap[(k - 1) / 2] > indx)
+    {
+      heap[k] = heap[(k - 1) / 2];
+      k = (k - 1) / 2;
+    }
+  heap[k] = indx;
+}
+
+static symindex
+elf_archive_scan_pop (struct elf_archive_scan *scan)
+{
+  symindex *heap = scan->heap;
+  symindex n = --scan->nheap;
+  symindex top = heap[0];
+  symindex last = heap[n];
+  symindex k = 0;
+  symindex child;
+
+  while ((child = 2 * k + 1) < n)
+    {
+      if (child + 1 < n && heap[child + 1] < heap[child])
+	child++;
+      if (heap[child] >= last)
+	break;
+      heap[k] = heap[child];
+      k = child;
+    }
+  heap[k] = last;
+  return top;
+}
+
+/* Queue for the current pass of SCAN the archive map entries from
+   FROM onwards that may be satisfied by a symbol on the undefined
+   list starting at H and that are not yet INCLUDED.  */
+
+static void
+elf_archive_scan_queue (struct elf_archive_scan *scan,
+			struct bfd_link_hash_entry *h,
+			symindex from, const unsigned char *included)
+{
+  for (; h != NULL; h = h->u.undef.next)
+    {
+      struct elf_archive_index_entry *ent;
+      struct elf_archive_index_ref *ref;
+
+      ent = (struct elf_archive_index_entry *)
+	bfd_hash_lookup (&scan->index, h->root.string, false, false);
+      if (ent == NULL)
+	continue;
+      for (ref = ent->refs; ref != NULL; ref = ref->next)
+	if (ref->indx >= from
+	    && !included[ref->indx]
+	    && scan->queued[ref->indx] != scan->pass)
+	  {
+	    scan->queued[ref->indx] = scan->pass;
+	    elf_archive_scan_push (scan, ref->indx);
+	  }
+    }
+}
+
 /* Add symbols from an ELF archive file to the linker hash table.  We
    don't use _bfd_generic_link_add_archive_symbols because we need to
    handle versioned symbols.
@@ -5968,7 +6176,12 @@ _bfd_elf_archive_symbol_lookup (bfd *abfd,
    object file.
 
    Unfortunately, we do have to make multiple passes over the symbol
-   table until nothing further is resolved.  */
+   table until nothing further is resolved.  Only the first pass looks
+   at every entry.  An entry not found undefined then can only be
+   needed later once its symbol appears on the undefined list, or if
+   the probe left it pending (see struct elf_archive_scan), so later
+   passes probe just those entries, in the same order as a full pass
+   would.  */
 
 static bool
 elf_link_add_archive_symbols (bfd *abfd, struct bfd_link_info *info)
@@ -5981,6 +6194,8 @@ elf_link_add_archive_symbols (bfd *abfd, struct bfd_link_info *info)
   const struct elf_backend_data *bed;
   struct bfd_link_hash_entry * (*archive_symbol_lookup)
     (bfd *, struct bfd_link_info *, const char *);
+  struct elf_archive_scan scan;
+  bool indexed;
 
   if (! bfd_has_map (abfd))
     {
@@ -6006,25 +6221,53 @@ elf_link_add_archive_symbols (bfd *abfd, struct bfd_link_info *info)
   bed = get_elf_backend_data (abfd);
   archive_symbol_lookup = bed->elf_backend_archive_symbol_lookup;
 
+  /* The index only knows the names _bfd_elf_archive_symbol_lookup
+     looks up.  With any other lookup, every pass looks at every
+     entry.  */
+  indexed = false;
+  scan.recheck = NULL;
+  scan.nrecheck = 0;
+  if (archive_symbol_lookup == _bfd_elf_archive_symbol_lookup)
+    {
+      scan.recheck = (symindex *) bfd_malloc (c * sizeof (*scan.recheck));
+      if (scan.recheck == NULL)
+	goto error_return;
+    }
+
   do
     {
       file_ptr last;
       symindex i;
+      symindex next;
       carsym *symdef;
-      carsym *symdefend;
+      struct bfd_link_hash_entry *pass_undefs_tail;
 
       loop = false;
       last = -1;
+      next = 0;
+      pass_undefs_tail = info->hash->undefs_tail;
 
-      symdef = symdefs;
-      symdefend = symdef + c;
-      for (i = 0; symdef < symdefend; symdef++, i++)
+      for (;;)
 	{
 	  struct bfd_link_hash_entry *h;
 	  bfd *element;
 	  struct bfd_link_hash_entry *undefs_tail;
 	  symindex mark;
 
+	  if (indexed)
+	    {
+	      if (scan.nheap == 0)
+		break;
+	      i = elf_archive_scan_pop (&scan);
+	    }
+	  else
+	    {
+	      if (next == c)
+		break;
+	      i = next++;
+	    }
+	  symdef = symdefs + i;
+
 	  if (included[i])
 	    continue;
 	  if (symdef->file_offset == last)
@@ -6047,7 +6290,7 @@ elf_link_add_archive_symbols (bfd *abfd, struct bfd_link_info *info)
 		 made undefined due to being in a discarded section.  */
 	      if (is_elf_hash_table (info->hash)
 		  && ((struct elf_link_hash_entry *) h)->indx == -3)
-		continue;
+		goto recheck;
 	    }
 	  else if (h->type == bfd_link_hash_common)
 	    {
@@ -6064,13 +6307,15 @@ elf_link_add_archive_symbols (bfd *abfd, struct bfd_link_info *info)
 		 table and check that to see what kind of symbol definition
 		 this is.  */
 	      if (! elf_link_is_defined_archive_symbol (abfd, symdef))
-		continue;
+		goto recheck;
 	    }
 	  else
 	    {
 	      if (h->type != bfd_link_hash_undefweak)
 		/* Symbol must be defined.  Don't check it again.  */
 		included[i] = true;
+	      else
+		goto recheck;
 	      continue;
 	    }
 
@@ -6087,7 +6332,7 @@ elf_link_add_archive_symbols (bfd *abfd, struct bfd_link_info *info)
 
 	  if (!(*info->callbacks
 		->add_archive_element) (info, element, symdef->name, &element))
-	    continue;
+	    goto recheck;
 	  if (!bfd_link_add_symbols (element, info))
 	    goto error_return;
 
@@ -6099,7 +6344,17 @@ elf_link_add_archive_symbols (bfd *abfd, struct bfd_link_info *info)
 	     does not require another pass.  This isn't a bug, but it
 	     does make the code less efficient than it could be.  */
 	  if (undefs_tail != info->hash->undefs_tail)
-	    loop = true;
+	    {
+	      loop = true;
+	      /* A full pass reaches entries after this one anyway, but
+		 an indexed pass must be told about them.  */
+	      if (indexed)
+		elf_archive_scan_queue (&scan,
+					(undefs_tail != NULL
+					 ? undefs_tail->u.undef.next
+					 : info->hash->undefs),
+					i + 1, included);
+	    }
 
 	  /* Look backward to mark all symbols from this object file
 	     which we have already seen in this pass.  */
@@ -6113,17 +6368,68 @@ elf_link_add_archive_symbols (bfd *abfd, struct bfd_link_info *info)
 	    }
 	  while (symdefs[mark].file_offset == symdef->file_offset);
 
-	  /* We mark subsequent symbols from this object file as we go
-	     on through the loop.  */
+	  /* Mark the symbols following it now, since an indexed pass
+	     might not come across them.  Any others from this object
+	     file are marked as we go on through the loop.  */
+	  for (mark = i + 1;
+	       mark < c && symdefs[mark].file_offset == symdef->file_offset;
+	       mark++)
+	    included[mark] = true;
 	  last = symdef->file_offset;
+	  continue;
+
+	recheck:
+	  if (scan.recheck != NULL)
+	    scan.recheck[scan.nrecheck++] = i;
+	}
+
+      if (loop && scan.recheck != NULL)
+	{
+	  symindex r, nrecheck;
+
+	  /* Build the index only once a second pass is needed, as most
+	     archives are done with in one.  */
+	  if (!indexed)
+	    {
+	      if (!elf_archive_scan_init (&scan, symdefs, c))
+		goto error_return;
+	      indexed = true;
+	    }
+
+	  /* Queue the next pass: the pending entries, and those that
+	     may be satisfied by a symbol that became undefined during
+	     this pass.  */
+	  scan.pass++;
+	  nrecheck = scan.nrecheck;
+	  scan.nrecheck = 0;
+	  for (r = 0; r < nrecheck; r++)
+	    {
+	      i = scan.recheck[r];
+	      if (!included[i] && scan.queued[i] != scan.pass)
+		{
+		  scan.queued[i] = scan.pass;
+		  elf_archive_scan_push (&scan, i);
+		}
+	    }
+	  elf_archive_scan_queue (&scan,
+				  (pass_undefs_tail != NULL
+				   ? pass_undefs_tail->u.undef.next
+				   : info->hash->undefs),
+				  0, included);
 	}
     }
   while (loop);
 
+  if (indexed)
+    elf_archive_scan_free (&scan);
+  free (scan.recheck);
   free (included);
   return true;
 
  error_return:
+  if (indexed)
+    elf_archive_scan_free (&scan);
+  free (scan.recheck);
   free (included);
   return false;
 }
@@ -8127,6 +8433,7 @@ _bfd_elf_link_hash_table_free (bfd *obfd)
   if (htab->dynstr != NULL)
     _bfd_elf_strtab_free (htab->dynstr);
   _bfd_merge_sections_free (htab->merge_info);
+  free (htab->gc_mark_stack);
   _bfd_generic_link_hash_table_free (obfd);
 }
 
@@ -11404,6 +11711,16 @@ elf_link_input_bfd (struct elf_final_link_info *flinfo, bfd *input_bfd)
 	   contents anymore, they have been recorded earlier.  Except
 	   if the backend has special provisions for writing sections.  */
 	contents = NULL;
+      else if (!(o->flags & SEC_RELOC)
+	       && !bed->elf_backend_write_section
+	       && o->sec_info_type == SEC_INFO_TYPE_NONE)
+	{
+	  /* The contents are copied unchanged to the output, so use
+	     them straight from the mapped input file if possible.  */
+	  contents = flinfo->contents;
+	  if (! bfd_get_section_contents_view (input_bfd, o, &contents))
+	    return false;
+	}
       else
 	{
 	  contents = flinfo->contents;
@@ -13821,24 +14138,57 @@ _bfd_elf_gc_mark_reloc (struct bfd_link_info *info,
   return true;
 }
 
-/* The mark phase of garbage collection.  For a given section, mark
-   it and any sections in this section's group, and all the sections
-   which define symbols to which it refers.  */
+/* A section waiting on the _bfd_elf_gc_mark queue, and the hook to
+   use when scanning its relocs.  */
 
-bool
-_bfd_elf_gc_mark (struct bfd_link_info *info,
+struct elf_gc_mark_entry
+{
+  asection *sec;
+  elf_gc_mark_hook_fn gc_mark_hook;
+};
+
+/* Mark SEC and queue it to have its relocs scanned.  */
+
+static bool
+elf_gc_mark_push (struct bfd_link_info *info,
 		  asection *sec,
 		  elf_gc_mark_hook_fn gc_mark_hook)
 {
-  bool ret;
-  asection *group_sec, *eh_frame;
+  struct elf_link_hash_table *htab = elf_hash_table (info);
 
   sec->gc_mark = 1;
+  if (htab->gc_mark_count == htab->gc_mark_alloc)
+    {
+      size_t alloc = htab->gc_mark_alloc ? htab->gc_mark_alloc * 2 : 64;
+      struct elf_gc_mark_entry *stack;
+
+      stack = bfd_realloc (htab->gc_mark_stack, alloc * sizeof (*stack));
+      if (stack == NULL)
+	return false;
+      htab->gc_mark_stack = stack;
+      htab->gc_mark_alloc = alloc;
+    }
+  htab->gc_mark_stack[htab->gc_mark_count].sec = sec;
+  htab->gc_mark_stack[htab->gc_mark_count].gc_mark_hook = gc_mark_hook;
+  htab->gc_mark_count++;
+  return true;
+}
+
+/* Mark the sections in SEC's group, and all the sections which
+   define symbols to which SEC refers.  */
+
+static bool
+elf_gc_mark_section (struct bfd_link_info *info,
+		     asection *sec,
+		     elf_gc_mark_hook_fn gc_mark_hook)
+{
+  bool ret;
+  asection *group_sec, *eh_frame;
 
   /* Mark all the sections in the group.  */
   group_sec = elf_section_data (sec)->next_in_group;
   if (group_sec && !group_sec->gc_mark)
-    if (!_bfd_elf_gc_mark (info, group_sec, gc_mark_hook))
+    if (!elf_gc_mark_push (info, group_sec, gc_mark_hook))
       return false;
 
   /* Look through the section relocs.  */
@@ -13881,12 +14231,49 @@ _bfd_elf_gc_mark (struct bfd_link_info *info,
 
   eh_frame = elf_section_eh_frame_entry (sec);
   if (ret && eh_frame && !eh_frame->gc_mark)
-    if (!_bfd_elf_gc_mark (info, eh_frame, gc_mark_hook))
+    if (!elf_gc_mark_push (info, eh_frame, gc_mark_hook))
       ret = false;
 
   return ret;
 }
 
+/* The mark phase of garbage collection.  For a given section, mark
+   it and any sections in this section's group, and all the sections
+   which define symbols to which it refers.
+
+   Sections are marked as soon as they are found and queued on an
+   explicit stack rather than visited recursively, so that long
+   reference chains cannot overflow the C stack.  A call made while
+   the stack is being drained, via _bfd_elf_gc_mark_reloc or a
+   backend hook, only queues SEC; the outermost call returns once
+   everything reachable has been marked.  */
+
+bool
+_bfd_elf_gc_mark (struct bfd_link_info *info,
+		  asection *sec,
+		  elf_gc_mark_hook_fn gc_mark_hook)
+{
+  struct elf_link_hash_table *htab = elf_hash_table (info);
+  bool ret;
+
+  if (!elf_gc_mark_push (info, sec, gc_mark_hook))
+    return false;
+  if (htab->gc_marking)
+    return true;
+
+  htab->gc_marking = true;
+  ret = true;
+  while (ret && htab->gc_mark_count != 0)
+    {
+      struct elf_gc_mark_entry e = htab->gc_mark_stack[--htab->gc_mark_count];
+
+      ret = elf_gc_mark_section (info, e.sec, e.gc_mark_hook);
+    }
+  htab->gc_mark_count = 0;
+  htab->gc_marking = false;
+  return ret;
+}
+
 /* Scan and mark sections in a special or debug section group.  */
 
 static void
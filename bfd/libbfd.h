@@ -968,6 +968,29 @@ struct bfd_iovec
 };
 extern const struct bfd_iovec _bfd_memory_iovec;
 
+struct bfd_file_view
+{
+  /* The start and size of the file in memory.  BASE is NULL if the
+     file could not be mapped.  */
+  void *base;
+  bfd_size_type size;
+  /* The page aligned region to pass to munmap.  */
+  void *map_addr;
+  bfd_size_type map_len;
+  /* The number of BFDs pointing at this view.  */
+  unsigned int refcount;
+  /* Set by bfd_cache_map_archive: reads of the archive owning this
+     view are served from the mapping instead of the file.  */
+  bool serves_reads;
+};
+
+struct bfd_file_view *_bfd_get_file_view
+   (bfd *abfd, file_ptr *origin) ATTRIBUTE_HIDDEN;
+
+bool _bfd_file_view_contains (bfd *abfd, const void *ptr) ATTRIBUTE_HIDDEN;
+
+void _bfd_free_file_view (bfd *abfd) ATTRIBUTE_HIDDEN;
+
 /* Extracted from archive.c.  */
 /* Used in generating armaps (archive tables of contents).  */
 struct orl             /* Output ranlib.  */
@@ -1008,6 +1031,8 @@ bfd_window_internal;
 /* Extracted from cache.c.  */
 bool bfd_cache_init (bfd *abfd) ATTRIBUTE_HIDDEN;
 
+void bfd_cache_map_archive (bfd *abfd) ATTRIBUTE_HIDDEN;
+
 FILE* bfd_open_file (bfd *abfd) ATTRIBUTE_HIDDEN;
 
 /* Extracted from hash.c.  */
@@ -834,6 +834,84 @@ strrevcmp_align (const void *a, const void *b)
   return lenA - lenB;
 }
 
+/* Both comparison functions above order strings first by the tail
+   alignment (strrevcmp_align only) and then by their last character,
+   with empty strings first.  Return that leading part of the sort key
+   for E, TAIL_MASK being the alignment minus one for strrevcmp_align
+   and zero for strrevcmp.  */
+
+static inline unsigned int
+strrev_bucket (const struct sec_merge_hash_entry *e, unsigned int tail_mask)
+{
+  unsigned int last = e->len ? 1 + (unsigned char) e->str[e->len - 1] : 0;
+
+  return (e->len & tail_mask) * 257 + last;
+}
+
+/* Below this many strings a single qsort is as quick.  */
+#define STRREV_BUCKET_MIN 1024
+
+/* Sort the N strings in ARRAY with CMP, one of the comparison functions
+   above.  The strings are first distributed into buckets by
+   strrev_bucket with a counting sort, and then each bucket is sorted on
+   its own.  Only strings in the same bucket can be suffixes of one
+   another, so the buckets are independent units of work, and since CMP
+   never returns zero the result is the same as sorting ARRAY whole.  */
+
+static bool
+strrev_sort (struct sec_merge_hash_entry **array, bfd_size_type n,
+	     unsigned int tail_mask,
+	     int (*cmp) (const void *, const void *))
+{
+  struct sec_merge_hash_entry **sorted;
+  bfd_size_type *end, i, lo;
+  unsigned int nbuckets, b;
+
+  if (n < STRREV_BUCKET_MIN || tail_mask > 255)
+    {
+      qsort (array, n, sizeof (*array), cmp);
+      return true;
+    }
+
+  nbuckets = (tail_mask + 1) * 257;
+  end = (bfd_size_type *) bfd_zmalloc (nbuckets * sizeof (*end));
+  sorted = (struct sec_merge_hash_entry **) bfd_malloc (n * sizeof (*sorted));
+  if (end == NULL || sorted == NULL)
+    {
+      free (end);
+      free (sorted);
+      return false;
+    }
+
+  /* Count the strings in each bucket, then turn the counts into the
+     start of each bucket.  */
+  for (i = 0; i < n; i++)
+    end[strrev_bucket (array[i], tail_mask)]++;
+  for (lo = 0, b = 0; b < nbuckets; b++)
+    {
+      bfd_size_type count = end[b];
+
+      end[b] = lo;
+      lo += count;
+    }
+
+  /* Scatter, leaving end[B] just past the last string of bucket B.  */
+  for (i = 0; i < n; i++)
+    sorted[end[strrev_bucket (array[i], tail_mask)]++] = array[i];
+  memcpy (array, sorted, n * sizeof (*array));
+  free (sorted);
+
+  for (lo = 0, b = 0; b < nbuckets; b++)
+    {
+      if (end[b] - lo > 1)
+	qsort (array + lo, end[b] - lo, sizeof (*array), cmp);
+      lo = end[b];
+    }
+
+  free (end);
+  return true;
+}
+
 static inline int
 is_suffix (const struct sec_merge_hash_entry *A,
 	   const struct sec_merge_hash_entry *B)
@@ -881,10 +959,18 @@ merge_strings (struct sec_merge_info *sinfo)
   sinfo->htab->size = a - array;
   if (sinfo->htab->size != 0)
     {
-      qsort (array, (size_t) sinfo->htab->size,
-	     sizeof (struct sec_merge_hash_entry *),
-	     (alignment != (unsigned) -1 && alignment > sinfo->htab->entsize
-	      ? strrevcmp_align : strrevcmp));
+      bool ok;
+
+      if (alignment != (unsigned) -1 && alignment > sinfo->htab->entsize)
+	ok = strrev_sort (array, sinfo->htab->size, alignment - 1,
+			  strrevcmp_align);
+      else
+	ok = strrev_sort (array, sinfo->htab->size, 0, strrevcmp);
+      if (!ok)
+	{
+	  free (array);
+	  return NULL;
+	}
 
       /* Loop over the sorted array and merge suffixes */
       e = *--a;
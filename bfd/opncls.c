@@ -160,6 +160,8 @@ _bfd_delete_bfd (bfd *abfd)
   if (abfd->memory && abfd->xvec)
     bfd_free_cached_info (abfd);
 
+  _bfd_free_file_view (abfd);
+
   /* The target _bfd_free_cached_info may not have done anything..  */
   if (abfd->memory)
     {
@@ -3779,7 +3779,7 @@ disassemble_section (bfd *abfd, asection *section, void *inf)
     }
   rel_ppend = PTR_ADD (rel_pp, rel_count);
 
-  if (!bfd_malloc_and_get_section (abfd, section, &data))
+  if (!bfd_get_section_contents_view (abfd, section, &data))
     {
       non_fatal (_("Reading section %s failed because: %s"),
 		 section->name, bfd_errmsg (bfd_get_error ()));
@@ -4062,7 +4062,7 @@ disassemble_section (bfd *abfd, asection *section, void *inf)
       sym = nextsym;
     }
 
-  free (data);
+  bfd_release_section_contents_view (abfd, data);
 
   if (rel_ppstart != NULL)
     free (rel_ppstart);
@@ -5018,7 +5018,7 @@ dump_section (bfd *abfd, asection *section, void *dummy ATTRIBUTE_UNUSED)
 	    (unsigned long) (section->filepos + start_offset));
   printf ("\n");
 
-  if (!bfd_get_full_section_contents (abfd, section, &data))
+  if (!bfd_get_section_contents_view (abfd, section, &data))
     {
       non_fatal (_("Reading section %s failed because: %s"),
 		 section->name, bfd_errmsg (bfd_get_error ()));
@@ -5090,7 +5090,7 @@ dump_section (bfd *abfd, asection *section, void *dummy ATTRIBUTE_UNUSED)
 	}
       putchar ('\n');
     }
-  free (data);
+  bfd_release_section_contents_view (abfd, data);
 }
 
 /* Actually display the various requested regions.  */
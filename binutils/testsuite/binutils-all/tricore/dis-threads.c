@@ -0,0 +1,244 @@
+/* Disassemble the same data from several threads at once.
+   Copyright (C) 2026 Free Software Foundation, Inc.
+
+   This file is part of the GNU Binutils.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston,
+   MA 02110-1301, USA.  */
+
+/* Usage: dis-threads ARCH
+
+   Every machine of ARCH gets THREADS_PER_MACH threads, which are all
+   released at the same time and disassemble the same pseudo-random
+   data, so that the first uses of the disassembler for the different
+   machines overlap.  Afterwards the data is disassembled once more for
+   each machine on the main thread, and the output of every thread is
+   compared with that.  */
+
+/* bfd.h refuses to be included without config.h.  */
+#define PACKAGE "dis-threads"
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bfd.h"
+#include "dis-asm.h"
+
+#define DATA_SIZE 0x4000
+#define THREADS_PER_MACH 4
+
+/* Text written by the disassembler.  */
+
+struct text
+{
+  char *buf;
+  size_t len;
+  size_t size;
+};
+
+struct job
+{
+  const bfd_arch_info_type *arch;
+  struct text out;
+  pthread_t thread;
+};
+
+static bfd_byte data[DATA_SIZE];
+
+static pthread_mutex_t start_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t start_cond = PTHREAD_COND_INITIALIZER;
+static int started;
+
+static void
+die (const char *s)
+{
+  printf ("oops: %s\n", s);
+  exit (1);
+}
+
+static int
+text_vprintf (struct text *t, const char *fmt, va_list ap)
+{
+  va_list ap2;
+  int n;
+
+  va_copy (ap2, ap);
+  n = vsnprintf (NULL, 0, fmt, ap2);
+  va_end (ap2);
+  if (n < 0)
+    die ("vsnprintf");
+  if (t->len + n + 1 > t->size)
+    {
+      t->size = 2 * (t->len + n + 1);
+      t->buf = realloc (t->buf, t->size);
+      if (t->buf == NULL)
+	die ("out of memory");
+    }
+  vsnprintf (t->buf + t->len, n + 1, fmt, ap);
+  t->len += n;
+  return n;
+}
+
+static int
+text_printf (void *stream, const char *fmt, ...)
+{
+  va_list ap;
+  int n;
+
+  va_start (ap, fmt);
+  n = text_vprintf ((struct text *) stream, fmt, ap);
+  va_end (ap);
+  return n;
+}
+
+static int
+text_styled_printf (void *stream,
+		    enum disassembler_style style ATTRIBUTE_UNUSED,
+		    const char *fmt, ...)
+{
+  va_list ap;
+  int n;
+
+  va_start (ap, fmt);
+  n = text_vprintf ((struct text *) stream, fmt, ap);
+  va_end (ap);
+  return n;
+}
+
+/* Disassemble all of DATA for ARCH into OUT.  */
+
+static void
+disassemble_data (const bfd_arch_info_type *arch, struct text *out)
+{
+  struct disassemble_info info;
+  disassembler_ftype disasm;
+  bfd_vma pc;
+  int n;
+
+  init_disassemble_info (&info, out, text_printf, text_styled_printf);
+  info.arch = arch->arch;
+  info.mach = arch->mach;
+  info.endian = BFD_ENDIAN_LITTLE;
+  info.endian_code = BFD_ENDIAN_LITTLE;
+  info.buffer = data;
+  info.buffer_vma = 0;
+  info.buffer_length = DATA_SIZE;
+  disassemble_init_for_target (&info);
+
+  disasm = disassembler (arch->arch, false, arch->mach, NULL);
+  if (disasm == NULL)
+    die ("no disassembler");
+
+  for (pc = 0; pc < DATA_SIZE; pc += n)
+    {
+      text_printf (out, "%08lx: ", (unsigned long) pc);
+      n = disasm (pc, &info);
+      text_printf (out, "\n");
+      if (n <= 0)
+	break;
+    }
+
+  disassemble_free_target (&info);
+}
+
+static void *
+run_job (void *arg)
+{
+  struct job *job = (struct job *) arg;
+
+  pthread_mutex_lock (&start_lock);
+  while (!started)
+    pthread_cond_wait (&start_cond, &start_lock);
+  pthread_mutex_unlock (&start_lock);
+
+  disassemble_data (job->arch, &job->out);
+  return NULL;
+}
+
+int
+main (int argc, char **argv)
+{
+  const bfd_arch_info_type *arch, *first;
+  struct job *jobs;
+  unsigned int njobs, i, seed;
+  int status = 0;
+
+  if (argc != 2)
+    die ("usage: dis-threads ARCH");
+
+  bfd_init ();
+  first = bfd_scan_arch (argv[1]);
+  if (first == NULL)
+    die ("unknown architecture");
+
+  seed = 12345;
+  for (i = 0; i < DATA_SIZE; i++)
+    {
+      seed = seed * 1103515245 + 12345;
+      data[i] = seed >> 16;
+    }
+
+  njobs = 0;
+  for (arch = first; arch != NULL; arch = arch->next)
+    njobs += THREADS_PER_MACH;
+  jobs = calloc (njobs, sizeof (*jobs));
+  if (jobs == NULL)
+    die ("out of memory");
+
+  i = 0;
+  for (arch = first; arch != NULL; arch = arch->next)
+    {
+      unsigned int j;
+
+      for (j = 0; j < THREADS_PER_MACH; j++, i++)
+	{
+	  jobs[i].arch = arch;
+	  if (pthread_create (&jobs[i].thread, NULL, run_job, &jobs[i]) != 0)
+	    die ("pthread_create");
+	}
+    }
+
+  pthread_mutex_lock (&start_lock);
+  started = 1;
+  pthread_cond_broadcast (&start_cond);
+  pthread_mutex_unlock (&start_lock);
+
+  for (i = 0; i < njobs; i++)
+    pthread_join (jobs[i].thread, NULL);
+
+  for (i = 0; i < njobs; i += THREADS_PER_MACH)
+    {
+      struct text serial = { NULL, 0, 0 };
+      unsigned int j, same = 0;
+
+      disassemble_data (jobs[i].arch, &serial);
+      for (j = i; j < i + THREADS_PER_MACH; j++)
+	if (jobs[j].out.len == serial.len
+	    && memcmp (jobs[j].out.buf, serial.buf, serial.len) == 0)
+	  same++;
+      printf ("%s: %u of %u threads match\n",
+	      jobs[i].arch->printable_name, same, THREADS_PER_MACH);
+      if (same != THREADS_PER_MACH)
+	status = 1;
+      free (serial.buf);
+      for (j = i; j < i + THREADS_PER_MACH; j++)
+	free (jobs[j].out.buf);
+    }
+
+  free (jobs);
+  return status;
+}
@@ -92,6 +92,8 @@ static const char symbol_chars[] =
 #define IS_COMMENT(c)			(lex[c] == LEX_IS_COMMENT_START)
 #define IS_LINE_COMMENT(c)		(lex[c] == LEX_IS_LINE_COMMENT_START)
 #define	IS_NEWLINE(c)			(lex[c] == LEX_IS_NEWLINE)
+#define IS_ORDINARY(c)			(lex[(unsigned char) (c)] == 0 \
+					 || IS_SYMBOL_COMPONENT ((unsigned char) (c)))
 
 static int process_escape (int);
 
@@ -394,6 +396,18 @@ scan_for_multibyte_characters (const unsigned char *  start,
   return found;
 }
 
+/* Return the first newline in FROM .. FROMEND, or FROMEND if there is
+   none.  Used to skip the bulk of a comment without looking at each
+   character in turn.  */
+
+static inline char *
+find_newline (char *from, char *fromend)
+{
+  char *nl = (char *) memchr (from, '\n', fromend - from);
+
+  return nl != NULL ? nl : fromend;
+}
+
 /* This function is called to process input characters.  The GET
    parameter is used to retrieve more input characters.  GET should
    set its parameter to point to a buffer, and return the length of
@@ -1056,6 +1070,7 @@ do_scrub_chars (size_t (*get) (char *, size_t), char *tostart, size_t tolen)
 	    {
 	      do
 		{
+		  from = find_newline (from, fromend);
 		  ch = GET ();
 		}
 	      while (ch != EOF && !IS_NEWLINE (ch));
@@ -1203,6 +1218,7 @@ do_scrub_chars (size_t (*get) (char *, size_t), char *tostart, size_t tolen)
 	  /* Read and skip to end of line.  */
 	  do
 	    {
+	      from = find_newline (from, fromend);
 	      ch = GET ();
 	    }
 	  while (ch != EOF && ch != '\n');
@@ -1272,7 +1288,10 @@ do_scrub_chars (size_t (*get) (char *, size_t), char *tostart, size_t tolen)
 		{
 		  /* Not a cpp line.  */
 		  while (ch != EOF && !IS_NEWLINE (ch))
-		    ch = GET ();
+		    {
+		      from = find_newline (from, fromend);
+		      ch = GET ();
+		    }
 		  if (ch == EOF)
 		    {
 		      as_warn (_("end of file in comment; newline inserted"));
@@ -1349,6 +1368,7 @@ do_scrub_chars (size_t (*get) (char *, size_t), char *tostart, size_t tolen)
 #endif
 	  do
 	    {
+	      from = find_newline (from, fromend);
 	      ch = GET ();
 	    }
 	  while (ch != EOF && !IS_NEWLINE (ch));
@@ -1419,48 +1439,25 @@ do_scrub_chars (size_t (*get) (char *, size_t), char *tostart, size_t tolen)
 	    state = 9;
 
 	  /* This is a common case.  Quickly copy CH and all the
-	     following symbol component or normal characters.  */
-	  if (to + 1 < toend
+	     following symbol component or normal characters, but for
+	     simplicity leave the last of them to be handled normally.
+	     Most such runs are short, so copy as we scan.  */
+	  if (to + 2 < toend
 	      && mri_state == NULL
 #if defined TC_ARM && defined OBJ_ELF
 	      && symver_state == NULL
 #endif
-	      )
+	      && from + 1 < fromend
+	      && IS_ORDINARY (from[0])
+	      && IS_ORDINARY (from[1]))
 	    {
-	      char *s;
-	      ptrdiff_t len;
-
-	      for (s = from; s < fromend; s++)
-		{
-		  int type;
-
-		  ch2 = *(unsigned char *) s;
-		  type = lex[ch2];
-		  if (type != 0
-		      && type != LEX_IS_SYMBOL_COMPONENT)
-		    break;
-		}
-
-	      if (s > from)
-		/* Handle the last character normally, for
-		   simplicity.  */
-		--s;
-
-	      len = s - from;
-
-	      if (len > (toend - to) - 1)
-		len = (toend - to) - 1;
-
-	      if (len > 0)
-		{
-		  PUT (ch);
-		  memcpy (to, from, len);
-		  to += len;
-		  from += len;
-		  if (to >= toend)
-		    goto tofull;
-		  ch = GET ();
-		}
+	      *to++ = ch;
+	      do
+		*to++ = *from++;
+	      while (from + 1 < fromend
+		     && to + 1 < toend
+		     && IS_ORDINARY (from[1]));
+	      ch = GET ();
 	    }
 
 	  /* Fall through.  */
@@ -1510,6 +1507,17 @@ do_scrub_chars (size_t (*get) (char *, size_t), char *tostart, size_t tolen)
 	      state = 3;
 	    }
 	  PUT (ch);
+
+	  /* Normal characters leave states 2, 3 and 11 alone, so copy
+	     a run of them without going round the loop for each.  */
+	  if ((state == 2 || state == 3 || state == 11)
+	      && mri_state == NULL
+#if defined TC_ARM && defined OBJ_ELF
+	      && symver_state == NULL
+#endif
+	      )
+	    while (from < fromend && lex[*(unsigned char *) from] == 0)
+	      PUT (*from++);
 	  break;
 	}
     }
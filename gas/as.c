@@ -36,6 +36,7 @@
 #define INITIALIZING_EMULS
 
 #include "as.h"
+#include "safe-ctype.h"
 #include "subsegs.h"
 #include "output-file.h"
 #include "sb.h"
@@ -46,6 +47,10 @@
 #include "bfdver.h"
 #include "write.h"
 
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+
 #ifdef HAVE_ITBL_CPU
 #include "itbl-ops.h"
 #else
@@ -121,6 +126,9 @@ segT bss_section;
 /* Name of listing file.  */
 static char *listing_filename = NULL;
 
+/* Name of the file listing inputs and outputs for --batch.  */
+static const char *batch_file_name = NULL;
+
 static struct defsym_list *defsyms;
 
 static long start_time;
@@ -254,6 +262,8 @@ Options:\n\
   fprintf (stream, _("\
   --alternate             initially turn on alternate macro syntax\n"));
   fprintf (stream, _("\
+  --batch FILE            assemble each input in FILE to the output after it\n"));
+  fprintf (stream, _("\
   --compress-debug-sections[={none|zlib|zlib-gnu|zlib-gabi|zstd}]\n\
                           compress DWARF debug sections\n")),
   fprintf (stream, _("\
@@ -437,6 +447,8 @@ parse_args (int * pargc, char *** pargv)
   int new_argc;
   char ** old_argv;
   char ** new_argv;
+  /* An option naming a single output, which --batch cannot honour.  */
+  const char *single_output_option = NULL;
   /* Starting the short option string with '-' is for programs that
      expect options and other ARGV-elements in any order and that care about
      the ordering of the two.  We describe each non-option ARGV-element
@@ -511,7 +523,8 @@ parse_args (int * pargc, char *** pargv)
       OPTION_NOCOMPRESS_DEBUG,
       OPTION_NO_PAD_SECTIONS,
       OPTION_MULTIBYTE_HANDLING,  /* = STD_BASE + 40 */
-      OPTION_SFRAME
+      OPTION_SFRAME,
+      OPTION_BATCH
     /* When you add options here, check that they do
        not collide with OPTION_MD_BASE.  See as.h.  */
     };
@@ -529,6 +542,7 @@ parse_args (int * pargc, char *** pargv)
     ,{"a", optional_argument, NULL, 'a'}
     /* Handle -al=<FILE>.  */
     ,{"al", optional_argument, NULL, OPTION_AL}
+    ,{"batch", required_argument, NULL, OPTION_BATCH}
     ,{"compress-debug-sections", optional_argument, NULL, OPTION_COMPRESS_DEBUG}
     ,{"nocompress-debug-sections", no_argument, NULL, OPTION_NOCOMPRESS_DEBUG}
     ,{"debug-prefix-map", required_argument, NULL, OPTION_DEBUG_PREFIX_MAP}
@@ -822,6 +836,11 @@ This program has absolutely no warranty.\n"));
 
 	case OPTION_DEPFILE:
 	  start_dependencies (optarg);
+	  single_output_option = "--MD";
+	  break;
+
+	case OPTION_BATCH:
+	  batch_file_name = optarg;
 	  break;
 
 	case 'g':
@@ -1028,7 +1047,10 @@ This program has absolutely no warranty.\n"));
  	case OPTION_AL:
 	  listing |= LISTING_LISTING;
 	  if (optarg)
-	    listing_filename = notes_strdup (optarg);
+	    {
+	      listing_filename = notes_strdup (optarg);
+	      single_output_option = "--al=FILE";
+	    }
 	  break;
 
  	case OPTION_ALTERNATE:
@@ -1084,6 +1106,7 @@ This program has absolutely no warranty.\n"));
 		    case '=':
 		      listing_filename = notes_strdup (optarg + 1);
 		      optarg += strlen (listing_filename);
+		      single_output_option = "-a=FILE";
 		      break;
 		    default:
 		      as_fatal (_("invalid listing option `%c'"), *optarg);
@@ -1116,6 +1139,7 @@ This program has absolutely no warranty.\n"));
 
 	case 'o':
 	  out_file_name = notes_strdup (optarg);
+	  single_output_option = "-o";
 	  break;
 
 	case 'w':
@@ -1136,6 +1160,10 @@ This program has absolutely no warranty.\n"));
   free (shortopts);
   free (longopts);
 
+  /* Every file assembled with --batch would write to the same output.  */
+  if (batch_file_name != NULL && single_output_option != NULL)
+    as_fatal (_("%s cannot be used with --batch"), single_output_option);
+
   *pargc = new_argc;
   *pargv = new_argv;
 
@@ -1295,7 +1323,8 @@ gas_early_init (int *argcp, char ***argvp)
 #endif
 }
 
-/* The bulk of gas initialisation.  This is after args are parsed.  */
+/* The bulk of gas initialisation.  This is after args are parsed, and
+   is done only once with --batch.  */
 
 static void
 gas_init (void)
@@ -1315,10 +1344,23 @@ gas_init (void)
   local_symbol_make (".gasversion.", absolute_section,
 		     &predefined_address_frag, BFD_VERSION / 10000UL);
 
+#ifdef tc_init_tables
+  tc_init_tables ();
+#endif
+
   /* Note: Put new initialisation calls that don't depend on stdoutput
      being open above this point.  stdoutput must be open for anything
      that might use stdoutput objalloc memory, eg. calling bfd_alloc
-     or creating global symbols (via bfd_make_empty_symbol).  */
+     or creating global symbols (via bfd_make_empty_symbol).  Those go
+     in gas_init_output.  */
+}
+
+/* Open the output file and finish initialisation.  With --batch this
+   is done once per input file.  */
+
+static void
+gas_init_output (void)
+{
   xatexit (output_file_close);
   output_file_create (out_file_name);
   gas_assert (stdoutput != 0);
@@ -1358,18 +1400,13 @@ gas_init (void)
     }
 }
 
-int
-main (int argc, char ** argv)
+/* Check that none of the input files in ARGV is the output file.  */
+
+static void
+check_output_file (int argc, char ** argv)
 {
-  char ** argv_orig = argv;
   struct stat sob;
 
-  gas_early_init (&argc, &argv);
-
-  /* Call parse_args before gas_init so that switches like
-     --hash-size can be honored.  */
-  parse_args (&argc, &argv);
-
   if (argc > 1 && stat (out_file_name, &sob) == 0)
     {
       int i;
@@ -1408,9 +1445,13 @@ main (int argc, char ** argv)
 	    }
 	}
     }
+}
 
-  gas_init ();
+/* Assemble the input files in ARGV, write the output file and exit.  */
 
+static void
+assemble_and_exit (int argc, char ** argv, char ** argv_orig)
+{
   /* Assemble it.  */
   perform_an_assembly_pass (argc, argv);
 
@@ -1496,3 +1537,184 @@ main (int argc, char ** argv)
 
   xexit (EXIT_SUCCESS);
 }
+
+/* Read the input and output file names for --batch.  Store them in
+   *PINPUTS and *POUTPUTS and return how many pairs there are.  */
+
+static size_t
+read_batch_file (char *** pinputs, char *** poutputs)
+{
+  FILE *f;
+  char *buf;
+  size_t len, alloc, count, n;
+  char **inputs = NULL, **outputs = NULL;
+  char *line, *next;
+  unsigned int lineno = 0;
+
+  f = fopen (batch_file_name, FOPEN_RT);
+  if (f == NULL)
+    as_fatal (_("can't open %s for reading: %s"),
+	      batch_file_name, xstrerror (errno));
+
+  alloc = 4096;
+  buf = XNEWVEC (char, alloc);
+  len = 0;
+  while ((n = fread (buf + len, 1, alloc - len - 1, f)) != 0)
+    {
+      len += n;
+      if (len == alloc - 1)
+	{
+	  alloc *= 2;
+	  buf = XRESIZEVEC (char, buf, alloc);
+	}
+    }
+  if (ferror (f))
+    as_fatal (_("can't read %s: %s"), batch_file_name, xstrerror (errno));
+  fclose (f);
+  buf[len] = '\0';
+
+  count = 0;
+  alloc = 0;
+  for (line = buf; *line != '\0'; line = next)
+    {
+      char *words[3];
+      int nwords = 0;
+      char *p;
+
+      ++lineno;
+      next = strchr (line, '\n');
+      if (next != NULL)
+	*next++ = '\0';
+      else
+	next = line + strlen (line);
+
+      p = line;
+      while (nwords < 3)
+	{
+	  while (ISSPACE (*p))
+	    ++p;
+	  if (*p == '\0' || (nwords == 0 && *p == '#'))
+	    break;
+	  words[nwords++] = p;
+	  while (*p != '\0' && !ISSPACE (*p))
+	    ++p;
+	  if (*p != '\0')
+	    *p++ = '\0';
+	}
+      if (nwords == 0)
+	continue;
+      if (nwords != 2)
+	{
+	  as_bad_where (batch_file_name, lineno,
+			_("expected an input and an output file name"));
+	  continue;
+	}
+
+      if (count == alloc)
+	{
+	  alloc = alloc * 2 + 16;
+	  inputs = XRESIZEVEC (char *, inputs, alloc);
+	  outputs = XRESIZEVEC (char *, outputs, alloc);
+	}
+      inputs[count] = strcmp (words[0], "-") == 0 ? (char *) "" : words[0];
+      outputs[count] = words[1];
+      ++count;
+    }
+
+  *pinputs = inputs;
+  *poutputs = outputs;
+  return count;
+}
+
+/* Assemble each input listed in the --batch file to its output, exactly
+   as separate runs of the assembler would.  Everything up to opening
+   the output file is done once.  Each file is then assembled in a
+   child process, which starts from a copy of that state and so needs
+   nothing reset afterwards.  The files are assembled one at a time so
+   that diagnostics come out in order.  */
+
+static void
+assemble_batch (int argc, char ** argv_orig)
+{
+#ifdef HAVE_FORK
+  char **inputs, **outputs;
+  size_t count, i;
+  int failed = 0;
+
+  if (argc > 1)
+    as_fatal (_("input files cannot be given with --batch"));
+
+  /* Don't let as_fatal remove a.out.  */
+  out_file_name = NULL;
+
+  count = read_batch_file (&inputs, &outputs);
+  if (had_errors ())
+    xexit (EXIT_FAILURE);
+
+  gas_init ();
+
+  for (i = 0; i < count; i++)
+    {
+      pid_t pid;
+      int status;
+
+      fflush (stdout);
+      fflush (stderr);
+      pid = fork ();
+      if (pid < 0)
+	as_fatal (_("can't fork: %s"), xstrerror (errno));
+      if (pid == 0)
+	{
+	  char *argv[3];
+
+	  argv[0] = myname;
+	  argv[1] = inputs[i];
+	  argv[2] = NULL;
+	  start_time = get_run_time ();
+	  out_file_name = outputs[i];
+	  check_output_file (2, argv);
+	  gas_init_output ();
+	  assemble_and_exit (2, argv, argv_orig);
+	}
+
+      if (waitpid (pid, &status, 0) < 0)
+	as_fatal (_("can't wait for child process: %s"), xstrerror (errno));
+      if (WIFSIGNALED (status))
+	{
+	  as_bad (_("assembly of %s terminated by signal %d"),
+		  inputs[i], WTERMSIG (status));
+	  failed = 1;
+	}
+      else if (!WIFEXITED (status) || WEXITSTATUS (status) != 0)
+	failed = 1;
+    }
+
+  xexit (failed ? EXIT_FAILURE : EXIT_SUCCESS);
+#else
+  (void) argc;
+  (void) argv_orig;
+  as_fatal (_("--batch is not supported on this host"));
+#endif
+}
+
+int
+main (int argc, char ** argv)
+{
+  char ** argv_orig = argv;
+
+  gas_early_init (&argc, &argv);
+
+  /* Call parse_args before gas_init so that switches like
+     --hash-size can be honored.  */
+  parse_args (&argc, &argv);
+
+  if (batch_file_name != NULL)
+    assemble_batch (argc, argv_orig);
+
+  check_output_file (argc, argv);
+
+  gas_init ();
+  gas_init_output ();
+
+  assemble_and_exit (argc, argv, argv_orig);
+}
@@ -236,6 +236,7 @@ iq2000_add_macro (const char *  name,
   macro->formal_count = 0;
   macro->formals = 0;
   macro->formal_hash = str_htab_create ();
+  macro->body = NULL;
   macro->file = as_where (&macro->line);
 
   sb_add_string (& macro->sub, semantics);
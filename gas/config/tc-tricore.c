@@ -318,16 +318,27 @@ typedef struct tricore_opcode opcode_t;
 typedef const struct tricore_core_register sfr_t;
 typedef struct pcp_opcode pcp_opcode_t;
 
-/* These are used to hash opcodes and SFRs.  */
+/* Opcodes and SFRs are looked up in the static tables of
+   tricore_find_opcode and tricore_find_sfr.  */
 
-static htab_t hash_ops = NULL;
-static htab_t hash_sfr = NULL;
 // TODO static htab_t hash_pcp = NULL;
 
 /* This is used to quickly find compatible operand types.  */
 
 static const char *pseudo_codes[256];
 
+/* The same, as bitmasks: an operand of type T (see the_insn.ops) is
+   compatible with an argument of kind K (see opcode_t.args) if
+   operand_class[T] & operand_accept[K] is non-zero.  Both are derived
+   from pseudo_codes in tricore_init_tables.  */
+
+static uint64_t operand_class[256];
+static uint64_t operand_accept[256];
+
+#define OPERAND_MATCHES(kind, type) \
+  ((operand_accept[(unsigned char) (kind)] \
+    & operand_class[(unsigned char) (type)]) != 0)
+
 /* Names of TriCore instruction formats (same order as in tricore.h).  */
 
 static const char *fmt_name[] =
@@ -510,6 +521,25 @@ typedef struct _tricore_insn_t
 
 static tricore_insn_t the_insn;
 
+/* The operand signature of an opcode, precomputed in tricore_init_tables
+   so that find_opcode can check a variant with a few bitwise tests.  The
+   need_* and no_unknown members have one bit per operand.  */
+
+typedef struct _opcode_sig_t
+{
+  uint64_t accept[MAX_OPS];	/* operand_accept[] of each argument.  */
+  unsigned char need_v;		/* Arguments of kind 'v'.  */
+  unsigned char need_6;		/* Arguments of kind '6'.  */
+  unsigned char need_k;		/* Arguments of kind 'k'.  */
+  unsigned char no_unknown;	/* Arguments of a 16-bit insn that can't be
+				   unknown ('U') unless .code16 is used.  */
+  unsigned char usable;		/* 1 if the opcode matches current_isa.  */
+} opcode_sig_t;
+
+/* Signatures of all opcodes, in the order of tricore_opcodes.  */
+
+static opcode_sig_t *opcode_sigs;
+
 #if 0
 TODO
 /* To select between several possible PCP relocation types, memory operands
@@ -1172,25 +1202,22 @@ static unsigned char tricore_insn_loop_ao = 0xfd;
 static char *insnline;
 static size_t insnline_len;
 
-/* md_begin initializes the TriCore-specific part of gas.  It is
-   called after md_parse_option, but prior to any other function
-   of this module.  */
+/* tricore_init_tables builds the insn conversion hash tables and the
+   operand tables for the selected ISA.  None of this depends on the
+   output file, so it is done once per run of the assembler, even when
+   --batch assembles several files.  Opcodes and SFRs need no set-up.  */
 
 void
-md_begin()
+tricore_init_tables (void)
 {
   int opind, hopind, i;
   opcode_t *pop, *hpop;
 // TODO   pcp_opcode_t *ppop, *hppop;
-  sfr_t *psfr;
   insn16_t *pinsn16;
   insn32_t *pinsn32;
   conv_t *palt;
   unsigned long mach;
 
-  if (show_internals)
-    printf ("*** md_begin()\n");
-
   /* Initialize ISA-specific variables.  */
 
   switch (current_isa & TRICORE_ISA_MASK)
@@ -1255,22 +1282,29 @@ md_begin()
     }
   tricore_init_arch_vars (mach);
 
+  /* Check the static opcode and SFR tables if in debug mode.  */
+
+  if (show_internals)
+    {
+      const char *err = tricore_check_hash_tables ();
+
+      if (err != NULL)
+	as_fatal (_("Internal error: %s"), err);
+    }
+
   /* Create the various hash tables.  */
 
-  if (((hash_ops = str_htab_create ()) == NULL)
-      || ((hash_sfr = str_htab_create ()) == NULL)
+  if (((hash_insn16 = str_htab_create ()) == NULL)
 // TODO      || ((hash_pcp = str_htab_create ()) == NULL)
-      || ((hash_insn16 = str_htab_create ()) == NULL)
       || ((hash_insn32 = str_htab_create ()) == NULL))
     as_fatal (_("Cannot create hash tables"));
 
-  /* Populate the opcode hash table.  */
+  /* Find the range of opcodes sharing each mnemonic.  */
 
   pop = tricore_opcodes;
   for (opind = 0; opind < NUMOPCODES; ++opind)
     {
       hpop = pop; hopind = opind;
-      str_hash_insert (hash_ops, pop->name, (char *) pop, 0);
       while ((++hopind != NUMOPCODES) && !strcmp ((++hpop)->name, pop->name))
         /* Empty.  */;
       pop->insind = opind;
@@ -1298,15 +1332,6 @@ TODO
     }
 #endif
 
-  /* Populate the SFR hash table.  */
-
-  psfr = tricore_sfrs;
-  for (opind = 0; opind < NUMSFRS; ++opind, ++psfr)
-    if (MATCHES_ISA (psfr->isa))
-      {
-        str_hash_insert (hash_sfr, psfr->name, (char *) psfr, 0);
-      }
-
   /* Populate the 16->32-bit-insn-conversion hash table.  */
 
   pinsn16 = insn16_table;
@@ -1316,7 +1341,7 @@ TODO
         continue;
 
       str_hash_insert (hash_insn16, pinsn16->name, (char *) pinsn16, 0);
-      pop = (opcode_t *) str_hash_find (hash_ops, pinsn16->new_name);
+      pop = tricore_find_opcode (pinsn16->new_name);
       if ((hpop = pop) == NULL)
         as_fatal (_("Internal error: couldn't find `%s'"), pinsn16->new_name);
       for (hopind = hpop->insind; hopind <= hpop->inslast; ++hopind, ++pop)
@@ -1342,7 +1367,7 @@ TODO
       for (i = 0; i < pinsn32->nr_alt; ++i)
         {
 	  palt = &pinsn32->alt[i];
-	  pop = (opcode_t *) str_hash_find (hash_ops, palt->new_name);
+	  pop = tricore_find_opcode (palt->new_name);
 	  if ((hpop = pop) == NULL)
 	    as_fatal (_("Internal error: couldn't find `%s'"), palt->new_name);
 	  for (hopind = hpop->insind; hopind <= hpop->inslast; ++hopind, ++pop)
@@ -1419,6 +1444,73 @@ TODO
   pseudo_codes['?'] = "?";
   pseudo_codes['S'] = "S";
 
+  /* Assign a class bit to each operand type, and compute which classes
+     each argument kind accepts.  Bit 0 stands for a missing operand
+     type, which strchr used to find in any of the strings.  */
+
+  {
+    int nclasses = 1;
+    const char *pc;
+
+    memset (operand_class, 0, sizeof (operand_class));
+    memset (operand_accept, 0, sizeof (operand_accept));
+    operand_class[0] = 1;
+    for (opind = 0; opind < 256; ++opind)
+      {
+	if (pseudo_codes[opind] == NULL)
+	  continue;
+
+	operand_accept[opind] = operand_class[0];
+	for (pc = pseudo_codes[opind]; *pc; ++pc)
+	  {
+	    unsigned char c = *pc;
+
+	    if (operand_class[c] == 0)
+	      {
+		if (nclasses == 64)
+		  as_fatal (_("Internal error: too many operand types"));
+		operand_class[c] = (uint64_t) 1 << nclasses++;
+	      }
+	    operand_accept[opind] |= operand_class[c];
+	  }
+      }
+  }
+
+  /* Compute the operand signatures of all opcodes.  */
+
+  opcode_sigs = XCNEWVEC (opcode_sig_t, NUMOPCODES);
+  for (opind = 0, pop = tricore_opcodes; opind < NUMOPCODES; ++opind, ++pop)
+    {
+      opcode_sig_t *sig = &opcode_sigs[opind];
+
+      sig->usable = MATCHES_ISA (pop->isa) ? 1 : 0;
+      for (i = 0; (i < pop->nr_operands) && (i < MAX_OPS); ++i)
+	{
+	  unsigned char kind = pop->args[i];
+
+	  sig->accept[i] = operand_accept[kind];
+	  if (kind == 'v')
+	    sig->need_v |= 1 << i;
+	  else if (kind == '6')
+	    sig->need_6 |= 1 << i;
+	  else if (kind == 'k')
+	    sig->need_k |= 1 << i;
+	  if (!pop->len32 && !strchr ("mxrRoO", kind))
+	    sig->no_unknown |= 1 << i;
+	}
+    }
+}
+
+/* md_begin initializes the TriCore-specific part of gas for an output
+   file.  It is called after md_parse_option and tricore_init_tables,
+   but prior to any other function of this module.  */
+
+void
+md_begin()
+{
+  if (show_internals)
+    printf ("*** md_begin()\n");
+
   /* Allocate memory for the temporary line buffer.  */
 
   insnline = xmalloc (INITIAL_INSNLINELENGTH);
@@ -1439,8 +1531,8 @@ TODO
 /* Check whether the tables for 16/32-bit insn conversions are OK.
    However, we can only test the correctness of the name-operand
    combo of the source insns (the correctness of the target insns
-   is tested in md_begin, though).  This function is only called
-   if show_internals is set, and thus only used for debugging.  */
+   is tested in tricore_init_tables, though).  This function is only
+   called if show_internals is set, and thus only used for debugging.  */
 
 static void
 check_insn_tables ()
@@ -1461,7 +1553,7 @@ check_insn_tables ()
       if ((cp = strchr (name, '-')) == NULL)
         as_fatal (_("Internal error: insn16_table is broken"));
       *cp++ = '\0';
-      pop = (opcode_t *) str_hash_find (hash_ops, name);
+      pop = tricore_find_opcode (name);
       if ((hpop = pop) == NULL)
         as_fatal (_("Internal error: can't find `%s' (insn16_table)"), name);
       for (hopind = hpop->insind; hopind <= hpop->inslast; ++hopind, ++pop)
@@ -1485,7 +1577,7 @@ check_insn_tables ()
       if ((cp = strchr (name, '-')) == NULL)
         as_fatal (_("Internal error: insn32_table is broken"));
       *cp++ = '\0';
-      pop = (opcode_t *) str_hash_find (hash_ops, name);
+      pop = tricore_find_opcode (name);
       if ((hpop = pop) == NULL)
         as_fatal (_("Internal error: can't find `%s' (insn32_table)"), name);
       for (hopind = hpop->insind; hopind <= hpop->inslast; ++hopind, ++pop)
@@ -2252,7 +2344,7 @@ md_undefined_symbol (char *name)
         else
           *dst++ = *src++;
       *dst = '\0';
-      creg = str_hash_find (hash_sfr, cname);
+      creg = tricore_find_sfr (cname, current_isa);
       free (cname);
       if (creg != NULL)
         {
@@ -2656,7 +2748,7 @@ tricore_ip (char *str)
   else if ((*insnline == 'f') && !strcmp (insnline, "fcall"))
     the_insn.is_call = 1;
 
-  if ((the_insn.code = (opcode_t *) str_hash_find (hash_ops, insnline)) == NULL)
+  if ((the_insn.code = tricore_find_opcode (insnline)) == NULL)
     {
       the_insn.error = _("Unknown instruction");
       return;
@@ -2973,7 +3065,7 @@ insn16_to_insn32 ()
 
       for (op = 0; op < the_insn.nops; ++op)
         {
-	  if (!strchr (pseudo_codes[(int)(pop->args[op])], the_insn.ops[op]))
+	  if (!OPERAND_MATCHES (pop->args[op], the_insn.ops[op]))
 	    break;
 	  if ((pop->args[op] == 'v') && !the_insn.matches_v[op])
 	    break;
@@ -3083,14 +3175,14 @@ optimize_insn (opcode_t *pop)
 	case 2:
 	  if ((the_insn.regs[0] == the_insn.regs[1])
 	      && (the_insn.ops[2] != 'U')
-	      && strchr (pseudo_codes['4'], the_insn.ops[2]))
+	      && OPERAND_MATCHES ('4', the_insn.ops[2]))
 	    del_opnr = 0;
 	  break;
 
 	case 3:
 	  if ((the_insn.regs[0] == 15) && (the_insn.regs[1] == 15)
 	      && (the_insn.ops[2] != 'U')
-	      && strchr (pseudo_codes['8'], the_insn.ops[2]))
+	      && OPERAND_MATCHES ('8', the_insn.ops[2]))
 	    del_opnr = 0;
 	  break;
 
@@ -3104,26 +3196,26 @@ optimize_insn (opcode_t *pop)
 	  if ((the_insn.regs[0] == the_insn.regs[2])
 	      && (the_insn.regs[1] == 15)
 	      && (the_insn.ops[3] != 'U')
-	      && strchr (pseudo_codes['4'], the_insn.ops[3]))
+	      && OPERAND_MATCHES ('4', the_insn.ops[3]))
 	    del_opnr = 2;
 	  break;
 
 	case 6:
 	  if ((the_insn.regs[0] == 15)
 	      && ((the_insn.ops[1] != 'U') && (VAL (1) == 0))
-	      && strchr (pseudo_codes['R'], the_insn.ops[2]))
+	      && OPERAND_MATCHES ('R', the_insn.ops[2]))
 	    del_opnr = 1;
 	  break;
 
 	case 7:
 	  if (((the_insn.ops[1] != 'U') && (VAL (1) == 0))
-	      && strchr (pseudo_codes['m'], the_insn.ops[2]))
+	      && OPERAND_MATCHES ('m', the_insn.ops[2]))
 	    del_opnr = 1;
 	  break;
 
 	case 8:
 	  if (((the_insn.ops[1] != 'U') && (VAL (1) == 1))
-	      && strchr (pseudo_codes['m'], the_insn.ops[2]))
+	      && OPERAND_MATCHES ('m', the_insn.ops[2]))
 	    del_opnr = 1;
 	  break;
 
@@ -3271,15 +3363,15 @@ optimize_16bit_jumps ()
       || (the_insn.ops[0] != 'i')
       || (the_insn.ops[1] != '1')
       || (VAL (1) != 0)
-      || !strchr (pseudo_codes['R'], the_insn.ops[2]))
+      || !OPERAND_MATCHES ('R', the_insn.ops[2]))
     return;
 
   if (!strcmp (the_insn.code->name, "jeq"))
     /* jeq %d15,0,m -> jz %d15,R  */
-    pop = (opcode_t *) str_hash_find (hash_ops, "jz");
+    pop = tricore_find_opcode ("jz");
   else if (!strcmp (the_insn.code->name, "jne"))
     /* jne %d15,0,m -> jnz %d15,R  */
-    pop = (opcode_t *) str_hash_find (hash_ops, "jnz");
+    pop = tricore_find_opcode ("jnz");
   else
     return;
 
@@ -3313,7 +3405,10 @@ static opcode_t *
 find_opcode ()
 {
   opcode_t *pop;
+  const opcode_sig_t *sig;
   int i, op, nops;
+  uint64_t classes[MAX_OPS];
+  unsigned int has_v = 0, has_6 = 0, has_k = 0, unknown_ops = 0;
 
   if (the_insn.needs_prefix || big_insns_only)
     use_insn32 = 1;
@@ -3326,38 +3421,50 @@ find_opcode ()
   pop = the_insn.code;
   nops = the_insn.nops;
 
+  /* Classify the operands once; each variant is then checked against
+     its precomputed signature.  */
+  for (op = 0; op < nops; ++op)
+    {
+      classes[op] = operand_class[the_insn.ops[op]];
+      if (the_insn.matches_v[op])
+	has_v |= 1 << op;
+      if (the_insn.matches_6[op])
+	has_6 |= 1 << op;
+      if (the_insn.matches_k[op])
+	has_k |= 1 << op;
+      if (the_insn.ops[op] == 'U')
+	unknown_ops |= 1 << op;
+    }
+
   for (i = the_insn.code->insind; i <= the_insn.code->inslast; ++pop, ++i)
     {
+      sig = &opcode_sigs[i];
       if ((pop->nr_operands != nops)
-          || !MATCHES_ISA (pop->isa)
+          || !sig->usable
           || (use_insn32 && !pop->len32)
           || (use_insn16 && pop->len32))
         continue;
 
       for (op = 0; op < nops; ++op)
-        {
-          if (!strchr (pseudo_codes[(int)(pop->args[op])], the_insn.ops[op])
-              || ((pop->args[op] == 'v') && !the_insn.matches_v[op])
-              || ((pop->args[op] == '6') && !the_insn.matches_6[op])
-	      || ((pop->args[op] == 'k') && !the_insn.matches_k[op]))
-            break;
+        if (!(sig->accept[op] & classes[op]))
+          break;
+      if ((op != nops)
+          || (sig->need_v & ~has_v)
+          || (sig->need_6 & ~has_6)
+          || (sig->need_k & ~has_k))
+        continue;
 
-	  /* Unless explicitly requested by a .code16 pseudo-opcode,
-	     don't accept a 16-bit insn if a non-PC-relative operand
-	     is unknown.  This reduces the relaxation pass to 16-bit
-	     PC-relative insns, which is a Good Thing[tm].  */
-	  if (!pop->len32 && (the_insn.ops[op] == 'U'))
-	    if (!use_insn16 && !strchr ("mxrRoO", pop->args[op]))
-	      break;
-	}
+      /* Unless explicitly requested by a .code16 pseudo-opcode,
+	 don't accept a 16-bit insn if a non-PC-relative operand
+	 is unknown.  This reduces the relaxation pass to 16-bit
+	 PC-relative insns, which is a Good Thing[tm].  */
+      if (!use_insn16 && (sig->no_unknown & unknown_ops))
+        continue;
 
-      if (op == nops)
-	{
-	  if (!optimize_next || use_insn32 || !pop->len32)
-	    return pop;
-	  else
-	    return optimize_insn (pop);
-	}
+      if (!optimize_next || use_insn32 || !pop->len32)
+	return pop;
+      else
+	return optimize_insn (pop);
     }
 
   /* We couldn't find a valid opcode so far, which could mean that
@@ -7498,7 +7605,7 @@ md_convert_frag (bfd *abfd ATTRIBUTE_UNUSED,
       ++the_insn.nops;
 
       /* Find the first opcode whose name is opc_name.  */
-      code = (opcode_t *) str_hash_find (hash_ops, opc_name);
+      code = tricore_find_opcode (opc_name);
       if (code == (opcode_t *) 0)
         {
           as_fatal (_("Internal error: couldn't lookup `%s'"), opc_name);
@@ -56,6 +56,10 @@
 extern void tricore_elf32_adjust_symtab(void);
 #define tc_adjust_symtab tricore_elf32_adjust_symtab
 
+/* Build the opcode tables once, before md_begin.  */
+#define tc_init_tables tricore_init_tables
+extern void tricore_init_tables (void);
+
 /* TriCore/PCP is little endian.  */
 #define md_number_to_chars number_to_chars_littleendian
 
@@ -102,6 +106,10 @@ extern long md_pcrel_from_section (struct fix *, segT);
 extern relax_substateT tricore_relax_loop_state;
 extern relax_substateT tricore_relax_loopu_state;
 
+/* Branches are relaxed by the generic table alone, so segments that
+   do not settle quickly can be finished by tracking frag dependencies.  */
+#define TC_RELAX_BY_DEPENDENCY 1
+
 /* BIN-76
  * ensure that externally visible symbols are not overridden by
  * section+ offset.
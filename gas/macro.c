@@ -59,6 +59,8 @@ int macro_defined;
 static int macro_number;
 
 static void free_macro (macro_entry *);
+static void free_macro_body (struct macro_body *);
+static struct macro_body *compile_macro_body (sb *, struct htab *);
 
 static void
 macro_del_f (void *ent)
@@ -645,6 +647,7 @@ free_macro (macro_entry *macro)
       del_formal (f);
     }
   htab_delete (macro->formal_hash);
+  free_macro_body (macro->body);
   sb_kill (&macro->sub);
   free ((char *) macro->name);
   free (macro);
@@ -668,6 +671,7 @@ define_macro (sb *in, sb *label, size_t (*get_line) (sb *))
   macro->formal_count = 0;
   macro->formals = 0;
   macro->formal_hash = str_htab_create ();
+  macro->body = NULL;
 
   idx = sb_skip_white (0, in);
   if (! buffer_and_nest ("MACRO", "ENDM", &macro->sub, get_line))
@@ -719,7 +723,10 @@ define_macro (sb *in, sb *label, size_t (*get_line) (sb *))
     }
 
   if (!error)
-    macro_defined = 1;
+    {
+      macro->body = compile_macro_body (&macro->sub, macro->formal_hash);
+      macro_defined = 1;
+    }
   else
     {
       as_bad_where (macro->file, macro->line, error, macro->name);
@@ -1022,6 +1029,252 @@ macro_expand_body (sb *in, sb *out, formal_entry *formals,
   return err;
 }
 
+/* A macro body compiled for the plain macro syntax, that is without
+   .altmacro or MRI mode: runs of text copied as they are, alternating
+   with formals and \@.  */
+
+enum macro_piece_type
+  {
+    MACRO_PIECE_TEXT,		/* The next LEN characters of TEXT.  */
+    MACRO_PIECE_FORMAL,		/* The value of FORMAL.  */
+    MACRO_PIECE_NUMBER		/* The macro invocation number.  */
+  };
+
+typedef struct macro_piece
+{
+  enum macro_piece_type type;
+  size_t len;
+  formal_entry *formal;
+} macro_piece;
+
+struct macro_body
+{
+  sb text;			/* The text of all the pieces.  */
+  macro_piece *pieces;
+  size_t count;
+  size_t alloc;
+};
+
+/* Add a piece of TYPE to BODY.  */
+
+static macro_piece *
+add_piece (struct macro_body *body, enum macro_piece_type type)
+{
+  macro_piece *piece;
+
+  if (body->count == body->alloc)
+    {
+      body->alloc = body->alloc * 2 + 8;
+      body->pieces = XRESIZEVEC (macro_piece, body->pieces, body->alloc);
+    }
+  piece = &body->pieces[body->count++];
+  piece->type = type;
+  piece->len = 0;
+  piece->formal = NULL;
+  return piece;
+}
+
+/* Add LEN characters at S to the text of BODY.  */
+
+static void
+add_piece_text (struct macro_body *body, const char *s, size_t len)
+{
+  macro_piece *piece;
+
+  if (body->count != 0
+      && body->pieces[body->count - 1].type == MACRO_PIECE_TEXT)
+    piece = &body->pieces[body->count - 1];
+  else
+    piece = add_piece (body, MACRO_PIECE_TEXT);
+  sb_add_buffer (&body->text, s, len);
+  piece->len += len;
+}
+
+/* Compile a reference to a formal, as sub_actual would expand it.  */
+
+static size_t
+compile_actual (size_t start, sb *in, sb *t, struct htab *formal_hash,
+		int kind, struct macro_body *body)
+{
+  size_t src;
+  formal_entry *ptr;
+
+  src = get_apost_token (start, in, t, kind);
+  ptr = str_hash_find (formal_hash, sb_terminate (t));
+  if (ptr)
+    add_piece (body, MACRO_PIECE_FORMAL)->formal = ptr;
+  else if (kind == '&')
+    {
+      add_piece_text (body, "&", 1);
+      add_piece_text (body, t->ptr, t->len);
+      if (src != start && in->ptr[src - 1] == '&')
+	add_piece_text (body, "&", 1);
+    }
+  else
+    {
+      add_piece_text (body, "\\", 1);
+      add_piece_text (body, t->ptr, t->len);
+    }
+  return src;
+}
+
+static void
+free_macro_body (struct macro_body *body)
+{
+  if (body != NULL)
+    {
+      sb_kill (&body->text);
+      free (body->pieces);
+      free (body);
+    }
+}
+
+/* Compile IN, the body of a macro with formals in FORMAL_HASH, so that
+   it can be expanded without scanning it again.  This follows the
+   plain syntax cases of macro_expand_body.  Return NULL if IN needs
+   macro_expand_body, either because of the current syntax or to
+   report an error.  */
+
+static struct macro_body *
+compile_macro_body (sb *in, struct htab *formal_hash)
+{
+  struct macro_body *body;
+  size_t src = 0;
+  sb t;
+
+  if (flag_mri || flag_macro_alternate)
+    return NULL;
+
+  body = XNEW (struct macro_body);
+  sb_new (&body->text);
+  body->pieces = NULL;
+  body->count = 0;
+  body->alloc = 0;
+  sb_new (&t);
+
+  while (src < in->len)
+    {
+      if (in->ptr[src] == '&')
+	{
+	  sb_reset (&t);
+	  src = compile_actual (src + 1, in, &t, formal_hash, '&', body);
+	}
+      else if (in->ptr[src] == '\\')
+	{
+	  src++;
+	  if (src < in->len && in->ptr[src] == '(')
+	    {
+	      size_t end = ++src;
+
+	      while (end < in->len && in->ptr[end] != ')')
+		end++;
+	      if (end == in->len)
+		{
+		  free_macro_body (body);
+		  body = NULL;
+		  break;
+		}
+	      add_piece_text (body, in->ptr + src, end - src);
+	      src = end + 1;
+	    }
+	  else if (src < in->len && in->ptr[src] == '@')
+	    {
+	      add_piece (body, MACRO_PIECE_NUMBER);
+	      src++;
+	    }
+	  else if (src < in->len && in->ptr[src] == '&')
+	    {
+	      add_piece_text (body, "\\&", 2);
+	      src++;
+	    }
+	  else
+	    {
+	      sb_reset (&t);
+	      src = compile_actual (src, in, &t, formal_hash, '\'', body);
+	    }
+	}
+      else
+	{
+	  size_t end = src + 1;
+
+	  while (end < in->len && in->ptr[end] != '&' && in->ptr[end] != '\\')
+	    end++;
+	  add_piece_text (body, in->ptr + src, end - src);
+	  src = end;
+	}
+    }
+
+  sb_kill (&t);
+  return body;
+}
+
+/* Expand BODY, compiled by compile_macro_body, onto OUT.  The whole
+   expansion is sized first and copied into place.  */
+
+static void
+expand_macro_body (const struct macro_body *body, sb *out)
+{
+  const char *text = body->text.ptr;
+  char number[12];
+  size_t len = 0;
+  size_t i;
+
+  number[0] = '\0';
+  for (i = 0; i < body->count; i++)
+    {
+      const macro_piece *piece = &body->pieces[i];
+
+      switch (piece->type)
+	{
+	case MACRO_PIECE_TEXT:
+	  len += piece->len;
+	  break;
+	case MACRO_PIECE_FORMAL:
+	  if (piece->formal->actual.len)
+	    len += piece->formal->actual.len;
+	  else
+	    len += piece->formal->def.len;
+	  break;
+	case MACRO_PIECE_NUMBER:
+	  if (number[0] == '\0')
+	    sprintf (number, "%d", macro_number);
+	  len += strlen (number);
+	  break;
+	}
+    }
+
+  sb_check (out, len + 1);
+  for (i = 0; i < body->count; i++)
+    {
+      const macro_piece *piece = &body->pieces[i];
+      const sb *value;
+
+      switch (piece->type)
+	{
+	case MACRO_PIECE_TEXT:
+	  memcpy (out->ptr + out->len, text, piece->len);
+	  out->len += piece->len;
+	  text += piece->len;
+	  break;
+	case MACRO_PIECE_FORMAL:
+	  if (piece->formal->actual.len)
+	    value = &piece->formal->actual;
+	  else
+	    value = &piece->formal->def;
+	  memcpy (out->ptr + out->len, value->ptr, value->len);
+	  out->len += value->len;
+	  break;
+	case MACRO_PIECE_NUMBER:
+	  memcpy (out->ptr + out->len, number, strlen (number));
+	  out->len += strlen (number);
+	  break;
+	}
+    }
+
+  if (out->len == 0 || out->ptr[out->len - 1] != '\n')
+    out->ptr[out->len++] = '\n';
+}
+
 /* Assign values to the formal parameters of a macro, and expand the
    body.  */
 
@@ -1203,7 +1456,15 @@ macro_expand (size_t idx, sb *in, macro_entry *m, sb *out)
 	    }
 	}
 
-      err = macro_expand_body (&m->sub, out, m->formals, m->formal_hash, m);
+      /* A macro defined under .altmacro or MRI mode is compiled on
+	 its first plain expansion.  */
+      if (m->body == NULL)
+	m->body = compile_macro_body (&m->sub, m->formal_hash);
+      if (m->body != NULL && !flag_mri && !flag_macro_alternate)
+	expand_macro_body (m->body, out);
+      else
+	err = macro_expand_body (&m->sub, out, m->formals, m->formal_hash,
+				 m);
     }
 
   /* Discard any unnamed formal arguments.  */
@@ -1314,6 +1575,7 @@ expand_irp (int irpc, size_t idx, sb *in, sb *out, size_t (*get_line) (sb *))
   sb sub;
   formal_entry f;
   struct htab *h;
+  struct macro_body *body;
   const char *err = NULL;
 
   idx = sb_skip_white (idx, in);
@@ -1344,6 +1606,8 @@ expand_irp (int irpc, size_t idx, sb *in, sb *out, size_t (*get_line) (sb *))
   f.next = NULL;
   f.type = FORMAL_OPTIONAL;
 
+  body = compile_macro_body (&sub, h);
+
   sb_reset (out);
 
   idx = sb_skip_comma (idx, in);
@@ -1387,7 +1651,10 @@ expand_irp (int irpc, size_t idx, sb *in, sb *out, size_t (*get_line) (sb *))
 	      ++idx;
 	    }
 
-	  err = macro_expand_body (&sub, out, &f, h, 0);
+	  if (body != NULL)
+	    expand_macro_body (body, out);
+	  else
+	    err = macro_expand_body (&sub, out, &f, h, 0);
 	  if (err != NULL)
 	    break;
 	  if (!irpc)
@@ -1397,6 +1664,7 @@ expand_irp (int irpc, size_t idx, sb *in, sb *out, size_t (*get_line) (sb *))
 	}
     }
 
+  free_macro_body (body);
   htab_delete (h);
  out1:
   sb_kill (&f.actual);
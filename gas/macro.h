@@ -64,6 +64,7 @@ typedef struct macro_struct
   int formal_count;			/* Number of formal args.  */
   formal_entry *formals;		/* List of formal_structs.  */
   htab_t formal_hash;			/* Hash table of formals.  */
+  struct macro_body *body;		/* Compiled substitution text.  */
   const char *name;			/* Macro name.  */
   const char *file;			/* File the macro was defined in.  */
   unsigned int line;			/* Line number of definition.  */
@@ -50,8 +50,6 @@
 #define MALLOC_OVERHEAD (2 * sizeof (size_t))
 #define INIT_ALLOC (64 - MALLOC_OVERHEAD - 1)
 
-static void sb_check (sb *, size_t);
-
 /* Initializes an sb.  */
 
 void
@@ -134,7 +132,7 @@ sb_scrub_and_add_sb (sb *ptr, sb *s)
 /* Make sure that the sb at ptr has room for another len characters,
    and grow it if it doesn't.  */
 
-static void
+void
 sb_check (sb *ptr, size_t len)
 {
   size_t want = ptr->len + len;
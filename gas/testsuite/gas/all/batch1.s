@@ -0,0 +1,5 @@
+	.globl	foo
+	.data
+foo:
+	.byte	1, 2, 3, 4
+	.long	bar
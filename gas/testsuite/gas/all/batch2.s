@@ -0,0 +1,8 @@
+	.globl	bar
+	.data
+bar:
+	.ascii	"batch"
+	.balign	4
+	.long	foo
+	.section .rodata
+	.byte	5
@@ -0,0 +1,2 @@
+# Nothing to assemble; -Y checks the opcode and SFR tables at startup.
+	.text
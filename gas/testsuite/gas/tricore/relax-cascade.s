@@ -0,0 +1,22 @@
+# Each branch only goes out of range once the next one has been
+# relaxed, so the branches grow one per pass, last to first.
+	.text
+b0:	jeq %d4, %d5, t0
+	.space 32756
+b1:	jeq %d4, %d5, t1
+t0:
+	.space 32756
+b2:	jeq %d4, %d5, t2
+t1:
+	.space 32756
+b3:	jeq %d4, %d5, t3
+t2:
+	.space 32756
+b4:	jeq %d4, %d5, t4
+t3:
+	.space 32756
+b5:	jeq %d4, %d5, t5
+t4:
+	.space 32800
+t5:
+	ret
@@ -0,0 +1,6 @@
+# SFR names are looked up in the generated SFR hash table.
+	.text
+	mtcr	$psw, %d0
+	mfcr	%d1, $pcxi
+	mtcr	$fcx, %d2
+	mfcr	%d3, $lcx
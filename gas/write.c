@@ -2536,6 +2536,17 @@ write_object_file (void)
 }
 
 #ifdef TC_GENERIC_RELAX_TABLE
+#if defined (TC_RELAX_BY_DEPENDENCY) \
+    && !defined (md_relax_frag) && !defined (md_generic_table_relax_frag)
+/* The target has asked for it, and machine dependent frags are relaxed
+   by relax_frag alone, so their size depends only on their state and
+   on the distance to their symbol.  Once a segment has taken
+   RELAX_PASSES_BEFORE_DEPENDENCY passes without settling, relax_segment
+   tracks those distances instead of rescanning the whole segment on
+   every pass.  */
+#define RELAX_BY_DEPENDENCY 1
+#define RELAX_PASSES_BEFORE_DEPENDENCY 2
+#endif
 #ifndef md_generic_table_relax_frag
 #define md_generic_table_relax_frag relax_frag
 #endif
@@ -2669,6 +2680,504 @@ relax_align (relax_addressT address,	/* Address now.  */
   return (new_address - address);
 }
 
+/* Statistics for --statistics: relaxation passes over all segments,
+   and the number of frags examined by those passes.  */
+static unsigned long relax_passes;
+static unsigned long relax_frag_visits;
+
+#ifdef RELAX_BY_DEPENDENCY
+
+/* Add GROWTH to the size of frag I in the Fenwick tree TREE of N
+   frag sizes.  */
+
+static void
+relax_tree_add (offsetT *tree, size_t n, size_t i, offsetT growth)
+{
+  for (i++; i <= n; i += i & -i)
+    tree[i] += growth;
+}
+
+/* Return the address of frag I, the sum of the sizes of frags 0 to
+   I - 1 in TREE.  */
+
+static relax_addressT
+relax_tree_address (const offsetT *tree, size_t i)
+{
+  relax_addressT address = 0;
+
+  for (; i != 0; i -= i & -i)
+    address += tree[i];
+  return address;
+}
+
+/* Push V onto the binary min-heap HEAP of *NUM elements.  */
+
+static void
+relax_heap_push (unsigned int *heap, size_t *num, unsigned int v)
+{
+  size_t i = (*num)++;
+
+  while (i != 0 && heap[(i - 1) / 2] > v)
+    {
+      heap[i] = heap[(i - 1) / 2];
+      i = (i - 1) / 2;
+    }
+  heap[i] = v;
+}
+
+/* Remove and return the smallest element of HEAP.  */
+
+static unsigned int
+relax_heap_pop (unsigned int *heap, size_t *num)
+{
+  unsigned int top = heap[0];
+  unsigned int last = heap[--*num];
+  size_t i = 0;
+
+  for (;;)
+    {
+      size_t c = 2 * i + 1;
+
+      if (c >= *num)
+	break;
+      if (c + 1 < *num && heap[c + 1] < heap[c])
+	c++;
+      if (last <= heap[c])
+	break;
+      heap[i] = heap[c];
+      i = c;
+    }
+  if (*num != 0)
+    heap[i] = last;
+  return top;
+}
+
+/* Set the addresses of frag I of FRAGS and of LO and HI, the ends of
+   the range it depends on, from the sizes in TREE, and relax it.  */
+
+static offsetT
+relax_frag_at (segT segment, fragS **frags, const offsetT *tree,
+	       size_t i, size_t lo, size_t hi)
+{
+  frags[i]->fr_address = relax_tree_address (tree, i);
+  frags[lo]->fr_address = relax_tree_address (tree, lo);
+  frags[hi]->fr_address = relax_tree_address (tree, hi);
+  return relax_frag (segment, frags[i], 0);
+}
+
+/* Return whether frag I of FRAGS would keep its state if the frags it
+   depends on, the last of which is frag HI - 1, grew by REACH bytes
+   more.  The addresses of frag I and of the frag of its target must be
+   up to date.  A frag that fits both at its current distance from its
+   target and at that greatest distance never needs another look.  */
+
+static bool
+relax_frag_settled (segT segment, fragS **frags, size_t i, size_t hi,
+		    offsetT reach)
+{
+  fragS probe;
+  bool settled;
+
+  memcpy (&probe, frags[i], SIZEOF_STRUCT_FRAG);
+  if (hi == i)
+    probe.fr_address += reach;
+  else
+    frags[hi]->fr_address += reach;
+  settled = (relax_frag (segment, &probe, 0) == 0
+	     && probe.fr_subtype == frags[i]->fr_subtype);
+  if (hi != i)
+    frags[hi]->fr_address -= reach;
+  return settled;
+}
+
+/* Relax the N frags of SEGMENT starting at ROOT, whose addresses have
+   been set by relax_segment, by re-examining a machine dependent frag
+   only when the distance to its target may have changed.
+
+   A branch frag depends on the sizes of the frags between itself and
+   the frag of its target symbol; a frag whose target is not in
+   SEGMENT depends on its own address.  After one pass over all frags,
+   those that still may grow have these ranges stored in a segment
+   tree over frag indices, so that when a frag grows the frags that
+   need another look can be found directly.  Frags are examined in
+   order, and a frag that needs another look at or before the current
+   one waits for the next pass.
+
+   This only works while frags never shrink and alignment padding
+   never changes, which holds when every possible growth of every
+   frag is a multiple of each alignment in the segment.  Under those
+   conditions this finds the same sizes as the general loop in
+   relax_segment.  Return FALSE, having changed nothing, if SEGMENT
+   does not qualify.  */
+
+static bool
+relax_segment_by_dependency (struct frag *root, segT segment, size_t n)
+{
+  const relax_typeS *table = TC_GENERIC_RELAX_TABLE;
+  fragS **frags;
+  relax_addressT *address;
+  relax_addressT at;
+  unsigned int *var, *lo, *hi, *start, *end, *deps;
+  unsigned int *heap, *next_heap;
+  char *queued, *next_queued, *done;
+  offsetT *size, *room;
+  size_t nvar, nheap, nnext, width, i, v;
+  valueT growth_bits, align_bits;
+  struct frag *fragP;
+  bool ok, grown;
+  int fill;
+
+  if (n > (unsigned int) -1 / 64)
+    return false;
+
+  frags = XNEWVEC (fragS *, n);
+  address = XNEWVEC (relax_addressT, n);
+  var = XNEWVEC (unsigned int, n);
+  lo = XNEWVEC (unsigned int, n);
+  hi = XNEWVEC (unsigned int, n);
+  room = XCNEWVEC (offsetT, n + 1);
+
+  /* Number the frags through fr_address, so that the frag of a
+     branch target can be found; the addresses are restored below.  */
+  for (i = 0, fragP = root; fragP; fragP = fragP->fr_next, i++)
+    {
+      frags[i] = fragP;
+      address[i] = fragP->fr_address;
+      fragP->fr_address = i;
+    }
+
+  ok = true;
+  nvar = 0;
+  growth_bits = 0;
+  align_bits = 0;
+  for (i = 0; i < n && ok; i++)
+    {
+      relax_substateT state;
+      symbolS *symbolP;
+      size_t j;
+
+      fragP = frags[i];
+      switch (fragP->fr_type)
+	{
+	case rs_fill:
+	  break;
+
+	case rs_align:
+	case rs_align_code:
+	case rs_align_test:
+	  if (fragP->fr_offset >= (offsetT) sizeof (valueT) * 8)
+	    ok = false;
+	  else
+	    align_bits |= ((valueT) 1 << fragP->fr_offset) - 1;
+	  break;
+
+	case rs_machine_dependent:
+	  state = fragP->fr_subtype;
+	  if (table[state].rlx_more == 0)
+	    break;
+
+	  /* Collect the bits of every size this frag may grow by, and
+	     the most it may grow by.  */
+	  for (; table[state].rlx_more; state = table[state].rlx_more)
+	    {
+	      if (table[table[state].rlx_more].rlx_length
+		  < table[state].rlx_length)
+		ok = false;
+	      growth_bits |= (table[table[state].rlx_more].rlx_length
+			      - table[fragP->fr_subtype].rlx_length);
+	    }
+	  room[i + 1] = (table[state].rlx_length
+			 - table[fragP->fr_subtype].rlx_length);
+
+	  symbolP = fragP->fr_symbol;
+	  if (symbolP == NULL
+	      || (symbol_constant_p (symbolP)
+		  && S_GET_SEGMENT (symbolP) != segment))
+	    j = 0;
+	  else if (symbol_constant_p (symbolP))
+	    {
+	      j = symbol_get_frag (symbolP)->fr_address;
+	      if (j >= n || frags[j] != symbol_get_frag (symbolP))
+		ok = false;
+	    }
+	  else
+	    {
+	      j = i;
+	      ok = false;
+	    }
+
+	  var[nvar] = i;
+	  if (j <= i)
+	    {
+	      lo[nvar] = j;
+	      hi[nvar] = i;
+	    }
+	  else
+	    {
+	      lo[nvar] = i;
+	      hi[nvar] = j;
+	    }
+	  nvar++;
+	  break;
+
+	default:
+	  ok = false;
+	  break;
+	}
+    }
+
+  for (i = 0; i < n; i++)
+    frags[i]->fr_address = address[i];
+
+  if (!ok || (growth_bits & align_bits) != 0)
+    {
+      free (frags);
+      free (address);
+      free (var);
+      free (lo);
+      free (hi);
+      free (room);
+      return false;
+    }
+
+  /* SIZE[I + 1] is the size of frag I, and ROOM[I + 1] how much more
+     it may grow.  The size of the last frag does not matter.  */
+  size = XNEWVEC (offsetT, n + 1);
+  size[0] = 0;
+  for (i = 0; i + 1 < n; i++)
+    size[i + 1] = address[i + 1] - address[i];
+  size[n] = 0;
+
+  /* One pass over all frags at their current addresses.  */
+  relax_passes++;
+  grown = false;
+  for (v = 0; v < nvar; v++)
+    {
+      offsetT growth;
+
+      i = var[v];
+      relax_frag_visits++;
+      growth = relax_frag (segment, frags[i], 0);
+      if (growth != 0)
+	{
+	  size[i + 1] += growth;
+	  room[i + 1] -= growth;
+	  grown = true;
+	}
+    }
+
+  done = NULL;
+  heap = NULL;
+  nheap = 0;
+  if (grown)
+    {
+      /* Lay the frags out again, and sum up ROOM.  */
+      at = 0;
+      for (i = 0; i < n; i++)
+	{
+	  frags[i]->fr_address = at;
+	  at += size[i + 1];
+	  room[i + 1] += room[i];
+	}
+
+      /* Queue the frags whose distance to their target changed,
+	 unless it can no longer matter.  */
+      done = XCNEWVEC (char, nvar);
+      heap = XNEWVEC (unsigned int, nvar);
+      for (v = 0; v < nvar; v++)
+	{
+	  i = var[v];
+	  if (table[frags[i]->fr_subtype].rlx_more == 0
+	      || relax_frag_settled (segment, frags, i, hi[v],
+				     room[hi[v]] - room[lo[v]]))
+	    done[v] = 1;
+	  else if ((frags[hi[v]]->fr_address - frags[lo[v]]->fr_address)
+		   != address[hi[v]] - address[lo[v]])
+	    heap[nheap++] = v;
+	}
+    }
+
+  if (nheap != 0)
+    {
+      /* From here on SIZE and ROOM are Fenwick trees.  */
+      for (i = 1; i <= n; i++)
+	if (i + (i & -i) <= n)
+	  size[i + (i & -i)] += size[i];
+      for (i = n; i != 0; i--)
+	room[i] -= room[i - (i & -i)];
+
+      /* Store the ranges of the frags that may still grow in a
+	 segment tree over frag indices: frag VAR[V] depends on frags
+	 LO[V] to HI[V] - 1.  The frags stored at node K are
+	 DEPS[START[K]] to DEPS[END[K] - 1].  */
+      for (width = 1; width < n; width *= 2)
+	;
+      start = XCNEWVEC (unsigned int, 2 * width + 1);
+      end = XNEWVEC (unsigned int, 2 * width);
+      deps = NULL;
+      for (fill = 0; fill < 2; fill++)
+	{
+	  for (v = 0; v < nvar; v++)
+	    {
+	      size_t l = lo[v] + width, r = hi[v] + width;
+
+	      if (done[v])
+		continue;
+	      for (; l < r; l /= 2, r /= 2)
+		{
+		  if (l & 1)
+		    {
+		      if (fill == 0)
+			start[l + 1]++;
+		      else
+			deps[start[l]++] = v;
+		      l++;
+		    }
+		  if (r & 1)
+		    {
+		      r--;
+		      if (fill == 0)
+			start[r + 1]++;
+		      else
+			deps[start[r]++] = v;
+		    }
+		}
+	    }
+	  if (fill == 0)
+	    {
+	      for (i = 1; i <= 2 * width; i++)
+		start[i] += start[i - 1];
+	      deps = XNEWVEC (unsigned int, start[2 * width] + 1);
+	    }
+	  else
+	    {
+	      /* Filling advanced each START[K] to START[K + 1].  */
+	      for (i = 2 * width; i != 0; i--)
+		{
+		  end[i - 1] = start[i - 1];
+		  start[i] = start[i - 1];
+		}
+	      start[0] = 0;
+	    }
+	}
+
+      next_heap = XNEWVEC (unsigned int, nvar);
+      queued = XCNEWVEC (char, nvar);
+      next_queued = XCNEWVEC (char, nvar);
+      for (v = 0; v < nheap; v++)
+	queued[heap[v]] = 1;
+      nnext = 0;
+
+      while (nheap != 0)
+	{
+	  relax_passes++;
+	  while (nheap != 0)
+	    {
+	      offsetT growth;
+	      size_t k;
+
+	      v = relax_heap_pop (heap, &nheap);
+	      queued[v] = 0;
+	      if (done[v])
+		continue;
+
+	      i = var[v];
+	      relax_frag_visits++;
+	      growth = relax_frag_at (segment, frags, size, i, lo[v], hi[v]);
+	      if (growth != 0)
+		{
+		  relax_tree_add (size, n, i, growth);
+		  relax_tree_add (room, n, i, -growth);
+		  if (hi[v] != i)
+		    frags[hi[v]]->fr_address += growth;
+		}
+	      if (table[frags[i]->fr_subtype].rlx_more == 0
+		  || relax_frag_settled (segment, frags, i, hi[v],
+					 (relax_tree_address (room, hi[v])
+					  - relax_tree_address (room, lo[v]))))
+		done[v] = 1;
+	      if (growth == 0)
+		continue;
+
+	      for (k = i + width; k != 0; k /= 2)
+		{
+		  size_t d = start[k];
+
+		  while (d < end[k])
+		    {
+		      unsigned int w = deps[d];
+
+		      /* Drop frags that need no further look from the
+			 list.  */
+		      if (done[w])
+			{
+			  deps[d] = deps[--end[k]];
+			  continue;
+			}
+		      d++;
+		      if (w > v)
+			{
+			  if (!queued[w])
+			    {
+			      queued[w] = 1;
+			      relax_heap_push (heap, &nheap, w);
+			    }
+			}
+		      else if (!next_queued[w])
+			{
+			  next_queued[w] = 1;
+			  relax_heap_push (next_heap, &nnext, w);
+			}
+		    }
+		}
+	    }
+
+	  {
+	    unsigned int *t = heap;
+	    char *q = queued;
+
+	    heap = next_heap;
+	    next_heap = t;
+	    queued = next_queued;
+	    next_queued = q;
+	    nheap = nnext;
+	    nnext = 0;
+	  }
+	}
+
+      /* Turn SIZE back into frag sizes, and lay the frags out.  */
+      for (i = n; i != 0; i--)
+	if (i + (i & -i) <= n)
+	  size[i + (i & -i)] -= size[i];
+      at = 0;
+      for (i = 0; i < n; i++)
+	{
+	  frags[i]->fr_address = at;
+	  at += size[i + 1];
+	}
+
+      free (start);
+      free (end);
+      free (deps);
+      free (next_heap);
+      free (queued);
+      free (next_queued);
+    }
+
+  free (frags);
+  free (address);
+  free (var);
+  free (lo);
+  free (hi);
+  free (size);
+  free (room);
+  free (done);
+  free (heap);
+  return true;
+}
+
+#endif /* RELAX_BY_DEPENDENCY */
+
 /* Now we have a segment, not a crowd of sub-segments, we can make
    fr_address values.
 
@@ -2789,6 +3298,7 @@ relax_segment (struct frag *segment_frag_root, segT segment, int pass)
   /* Do relax().  */
   {
     unsigned long max_iterations;
+    unsigned long passes = 0;
 
     /* Cumulative address adjustment.  */
     offsetT stretch;
@@ -2839,8 +3349,22 @@ relax_segment (struct frag *segment_frag_root, segT segment, int pass)
     ret = 0;
     do
       {
+#ifdef RELAX_BY_DEPENDENCY
+	/* Frags still growing after a couple of passes are likely
+	   pushing each other out of range one pass at a time.  Let
+	   relax_segment_by_dependency finish the job if it can.  */
+	if (passes == RELAX_PASSES_BEFORE_DEPENDENCY
+	    && relax_segment_by_dependency (segment_frag_root, segment,
+					    frag_count))
+	  {
+	    stretched = 0;
+	    break;
+	  }
+#endif
 	stretch = 0;
 	stretched = 0;
+	passes++;
+	relax_passes++;
 
 	for (fragP = segment_frag_root; fragP; fragP = fragP->fr_next)
 	  {
@@ -2849,6 +3373,7 @@ relax_segment (struct frag *segment_frag_root, segT segment, int pass)
 	    offsetT offset;
 	    symbolS *symbolP;
 
+	    relax_frag_visits++;
 	    fragP->relax_marker ^= 1;
 	    was_address = fragP->fr_address;
 	    address = fragP->fr_address += stretch;
@@ -3198,6 +3723,8 @@ void
 write_print_statistics (FILE *file)
 {
   fprintf (file, "fixups: %d\n", n_fixups);
+  fprintf (file, "relax passes: %lu, frag visits: %lu\n",
+	   relax_passes, relax_frag_visits);
 }
 
 /* For debugging.  */
@@ -4,6 +4,9 @@
 #include "frame.h"
 #include "gdbarch.h"
 #include "gdbcore.h"
+#include "cli/cli-cmds.h"
+#include "objfiles.h"
+#include "symtab.h"
 #include "gdbsupport/common-regcache.h"
 #include "gdbsupport/common-types.h"
 #include "gdbsupport/gdb_assert.h"
@@ -14,6 +17,10 @@
 #include "target-descriptions.h"
 #include "trad-frame.h"
 #include <cassert>
+#include <unordered_map>
+
+#include "elf/tricore.h"
+#include "opcode/tricore.h"
 
 #include "features/tricore.c"
 #include "tricore-tdep.h"
@@ -64,11 +71,478 @@ constexpr gdb_byte tricore_default_breakpoint[] = { 0x00, 0xA0 };
 
 typedef BP_MANIPULATION (tricore_default_breakpoint) tricore_breakpoint;
 
+/* Kinds of instructions the prologue analyzer recognises.  */
+enum tricore_prologue_kind
+{
+  TRICORE_PI_SUB_SP,    /* sub.a %sp,const8  */
+  TRICORE_PI_SUB_A,     /* sub.a %ad,%as1,%as2  */
+  TRICORE_PI_LEA,       /* lea %ad,[%as]off  */
+  TRICORE_PI_MOVH_A,    /* movh.a %ad,const16  */
+  TRICORE_PI_MOV_AA,    /* mov.aa %ad,%as  */
+  TRICORE_PI_MOV_A,     /* mov.a %ad,%ds / mov.a %ad,const4  */
+  TRICORE_PI_MOV_D,     /* mov, mov.u %dd,const  */
+  TRICORE_PI_MOVH_D,    /* movh %dd,const16  */
+  TRICORE_PI_STORE,     /* st.* [%as]off,reg  */
+  TRICORE_PI_SVLCX,     /* svlcx  */
+};
+
+/* Don't look further than this many instructions for the end of a
+   prologue.  */
+#define TRICORE_MAX_PROLOGUE_INSNS 32
+
+/* The result of analyzing the prologue of a function.  */
+struct tricore_prologue
+{
+  /* Address of the first instruction after the prologue.  */
+  CORE_ADDR end = 0;
+
+  /* The stack adjustments made by the prologue: the address of each
+     adjusting instruction and the number of bytes it allocates.  */
+  std::vector<std::pair<CORE_ADDR, LONGEST>> adjustments;
+
+  /* Whether %a14 is set up as a frame pointer, at which address, and how
+     many bytes had been allocated at that point.  */
+  bool has_fp = false;
+  CORE_ADDR fp_addr = 0;
+  LONGEST fp_offset = 0;
+
+  /* Whether the prologue saves the lower context with svlcx.  */
+  bool saves_lower = false;
+
+  /* Whether the analysis stopped on a memory error; such results are not
+     cached.  */
+  bool incomplete = false;
+};
+
+/* Prologue analyses of the functions of an objfile, keyed by their start
+   address, so that stepping and "finish" don't rescan the same code over
+   and over again.  */
+using tricore_prologue_map = std::unordered_map<CORE_ADDR, tricore_prologue>;
+
+static const registry<objfile>::key<tricore_prologue_map>
+    tricore_prologue_key;
+
+/* Return the TriCore instruction set matching the BFD machine MACH.  */
+static tricore_isa
+tricore_isa_from_mach (unsigned long mach)
+{
+  switch (mach & EF_EABI_TRICORE_CORE_MASK)
+    {
+    case EF_EABI_TRICORE_V1_1:
+      return TRICORE_RIDER_A;
+    case EF_EABI_TRICORE_V1_2:
+      return TRICORE_V1_2;
+    case EF_EABI_TRICORE_V1_3:
+      return TRICORE_V1_3;
+    case EF_EABI_TRICORE_V1_3_1:
+      return TRICORE_V1_3_1;
+    case EF_EABI_TRICORE_V1_6:
+      return TRICORE_V1_6;
+    case EF_EABI_TRICORE_V1_6_1:
+      return TRICORE_V1_6_1;
+    case EF_EABI_TRICORE_V1_8:
+      return TRICORE_V1_8;
+    default:
+      return TRICORE_V1_6_2;
+    }
+}
+
+/* Collect the entries of the opcode table that are of interest to the
+   prologue analyzer for MACH into TDEP.  */
+static void
+tricore_init_prologue_insns (tricore_gdbarch_tdep *tdep, unsigned long mach)
+{
+  unsigned long opmask[TRICORE_FMT_MAX] = { 0 };
+  tricore_isa isa = tricore_isa_from_mach (mach);
+
+  if (!tricore_get_opmask (mach, opmask))
+    tricore_get_opmask (EF_EABI_TRICORE_V1_6_2, opmask);
+
+  for (int i = 0; i < tricore_numopcodes; i++)
+    {
+      const struct tricore_opcode *op = &tricore_opcodes[i];
+      const char *name = op->name;
+      const char *args = op->args;
+      int kind;
+
+      if (op->isa != TRICORE_GENERIC && (op->isa & isa) == 0)
+        continue;
+
+      if (strcmp (name, "sub.a") == 0 && strcmp (args, "P8") == 0)
+        kind = TRICORE_PI_SUB_SP;
+      else if (strcmp (name, "sub.a") == 0 && strcmp (args, "aaa") == 0)
+        kind = TRICORE_PI_SUB_A;
+      else if (strcmp (name, "lea") == 0
+               && (strcmp (args, "a@w") == 0 || strcmp (args, "a@0") == 0))
+        kind = TRICORE_PI_LEA;
+      else if (strcmp (name, "movh.a") == 0)
+        kind = TRICORE_PI_MOVH_A;
+      else if (strcmp (name, "mov.aa") == 0)
+        kind = TRICORE_PI_MOV_AA;
+      else if (strcmp (name, "mov.a") == 0)
+        kind = TRICORE_PI_MOV_A;
+      else if ((strcmp (name, "mov") == 0 || strcmp (name, "mov.u") == 0)
+               && (args[0] == 'd' || args[0] == 'i')
+               && strchr ("48wW", args[1]) != NULL && args[2] == '\0')
+        kind = TRICORE_PI_MOV_D;
+      else if (strcmp (name, "movh") == 0)
+        kind = TRICORE_PI_MOVH_D;
+      else if (startswith (name, "st.") && (args[0] == '@' || args[0] == '&'))
+        kind = TRICORE_PI_STORE;
+      else if (strcmp (name, "svlcx") == 0)
+        kind = TRICORE_PI_SVLCX;
+      else
+        continue;
+
+      tdep->prologue_insns.push_back ({ op, opmask[op->format], kind });
+    }
+}
+
+/* Sign-extend the BITS-bit value VAL.  */
+static LONGEST
+tricore_sign_extend (ULONGEST val, int bits)
+{
+  ULONGEST sign = (ULONGEST) 1 << (bits - 1);
+
+  return (LONGEST) ((val ^ sign) - sign);
+}
+
+/* Return the value of operand N of INSN, which is encoded as OP.  Register
+   operands yield the register number, implicit ones included.  */
+static LONGEST
+tricore_insn_operand (const struct tricore_opcode *op, int n, ULONGEST insn)
+{
+  ULONGEST val;
+
+  switch (op->args[n])
+    {
+    case 'P':
+    case '&':
+      return 10;
+    case 'i':
+    case 'I':
+    case 'S':
+      return 15;
+    }
+
+  switch (op->format)
+    {
+    case TRICORE_FMT_BO:
+      if (op->fields[n] == FMT_BO_OFF10)
+        val = ((insn >> 16) & 0x3f) | ((insn >> 22) & 0x3c0);
+      else if (op->fields[n] == FMT_BO_S2)
+        val = (insn >> 12) & 0xf;
+      else
+        val = (insn >> 8) & 0xf;
+      break;
+    case TRICORE_FMT_BOL:
+      if (op->fields[n] == FMT_BOL_OFF16)
+        val = (((insn >> 16) & 0x3f) | ((insn >> 22) & 0x3c0)
+               | ((insn >> 12) & 0xfc00));
+      else if (op->fields[n] == FMT_BOL_S2)
+        val = (insn >> 12) & 0xf;
+      else
+        val = (insn >> 8) & 0xf;
+      break;
+    case TRICORE_FMT_RLC:
+      if (op->fields[n] == FMT_RLC_D)
+        val = (insn >> 28) & 0xf;
+      else if (op->fields[n] == FMT_RLC_CONST16)
+        val = (insn >> 12) & 0xffff;
+      else
+        val = (insn >> 8) & 0xf;
+      break;
+    case TRICORE_FMT_RR:
+      if (op->fields[n] == FMT_RR_D)
+        val = (insn >> 28) & 0xf;
+      else if (op->fields[n] == FMT_RR_S2)
+        val = (insn >> 12) & 0xf;
+      else
+        val = (insn >> 8) & 0xf;
+      break;
+    case TRICORE_FMT_SC:
+      val = (insn >> 8) & 0xff;
+      break;
+    default:
+      /* The remaining 16-bit formats (SRC, SRR, SRO, SSR) keep their
+         first field in bits 12..15 and their second one in bits 8..11.  */
+      if (op->fields[n] == '1')
+        val = (insn >> 12) & 0xf;
+      else
+        val = (insn >> 8) & 0xf;
+      break;
+    }
+
+  switch (op->args[n])
+    {
+    case '4':
+      return tricore_sign_extend (val, 4);
+    case '0':
+      return tricore_sign_extend (val, 10);
+    case 'w':
+      return tricore_sign_extend (val, 16);
+    case 'v':
+      return val << 1;
+    case '6':
+    case 'k':
+      return val << 2;
+    default:
+      return val;
+    }
+}
+
+/* Scan the prologue of the function starting at START, looking no
+   further than LIMIT, and record what it does in P.  Instructions that
+   only compute the size of the stack frame are followed, but the
+   prologue is only taken to extend up to the last instruction that
+   allocates stack, sets up the frame pointer or saves a register.  */
+static void
+tricore_analyze_prologue (struct gdbarch *gdbarch, CORE_ADDR start,
+                          CORE_ADDR limit, struct tricore_prologue *p)
+{
+  tricore_gdbarch_tdep *tdep = gdbarch_tdep<tricore_gdbarch_tdep> (gdbarch);
+  enum bfd_endian byte_order = gdbarch_byte_order_for_code (gdbarch);
+  bool a_known[16] = { false }, d_known[16] = { false };
+  ULONGEST a_val[16], d_val[16];
+  LONGEST size = 0;
+  CORE_ADDR pc = start;
+
+  p->end = start;
+  for (int count = 0; count < TRICORE_MAX_PROLOGUE_INSNS && pc < limit;
+       count++)
+    {
+      ULONGEST insn;
+      int len;
+
+      try
+        {
+          insn = read_code_unsigned_integer (pc, 2, byte_order);
+          len = (insn & 1) ? 4 : 2;
+          if (len == 4)
+            insn = read_code_unsigned_integer (pc, 4, byte_order);
+        }
+      catch (const gdb_exception_error &ex)
+        {
+          p->incomplete = true;
+          break;
+        }
+
+      const tricore_prologue_insn *match = nullptr;
+      for (const tricore_prologue_insn &pi : tdep->prologue_insns)
+        if (pi.op->len32 == (len == 4) && (insn & pi.mask) == pi.op->opcode
+            && (insn & pi.op->lose) == 0)
+          {
+            match = &pi;
+            break;
+          }
+      if (match == nullptr)
+        break;
+
+      const struct tricore_opcode *op = match->op;
+      CORE_ADDR next_pc = pc + len;
+      bool in_prologue = false;
+
+      switch (match->kind)
+        {
+        case TRICORE_PI_SUB_SP:
+          {
+            LONGEST n = tricore_insn_operand (op, 1, insn);
+
+            size += n;
+            p->adjustments.emplace_back (pc, n);
+            in_prologue = true;
+          }
+          break;
+
+        case TRICORE_PI_SUB_A:
+          {
+            int d = tricore_insn_operand (op, 0, insn);
+            int s1 = tricore_insn_operand (op, 1, insn);
+            int s2 = tricore_insn_operand (op, 2, insn);
+
+            if (d != 10 || s1 != 10 || !a_known[s2])
+              goto done;
+            size += a_val[s2];
+            p->adjustments.emplace_back (pc, a_val[s2]);
+            in_prologue = true;
+          }
+          break;
+
+        case TRICORE_PI_LEA:
+          {
+            int d = tricore_insn_operand (op, 0, insn);
+            int s = tricore_insn_operand (op, 1, insn);
+            LONGEST off = tricore_insn_operand (op, 2, insn);
+
+            if (d == 10 && s == 10)
+              {
+                size -= off;
+                p->adjustments.emplace_back (pc, -off);
+                in_prologue = true;
+              }
+            else if (d == 10)
+              goto done;
+            else
+              {
+                a_known[d] = a_known[s];
+                a_val[d] = (a_val[s] + off) & 0xffffffff;
+              }
+          }
+          break;
+
+        case TRICORE_PI_MOVH_A:
+          {
+            int d = tricore_insn_operand (op, 0, insn);
+
+            if (d == 10)
+              goto done;
+            a_known[d] = true;
+            a_val[d] = tricore_insn_operand (op, 1, insn) << 16;
+          }
+          break;
+
+        case TRICORE_PI_MOV_AA:
+          {
+            int d = tricore_insn_operand (op, 0, insn);
+            int s = tricore_insn_operand (op, 1, insn);
+
+            if (d == 10)
+              goto done;
+            if (d == 14 && s == 10)
+              {
+                p->has_fp = true;
+                p->fp_addr = pc;
+                p->fp_offset = size;
+                in_prologue = true;
+              }
+            a_known[d] = a_known[s];
+            a_val[d] = a_val[s];
+          }
+          break;
+
+        case TRICORE_PI_MOV_A:
+          {
+            int d = tricore_insn_operand (op, 0, insn);
+
+            if (d == 10)
+              goto done;
+            if (op->args[1] == 'd')
+              {
+                int s = tricore_insn_operand (op, 1, insn);
+
+                a_known[d] = d_known[s];
+                a_val[d] = d_val[s];
+              }
+            else
+              {
+                a_known[d] = true;
+                a_val[d] = tricore_insn_operand (op, 1, insn);
+              }
+          }
+          break;
+
+        case TRICORE_PI_MOV_D:
+        case TRICORE_PI_MOVH_D:
+          {
+            int d = tricore_insn_operand (op, 0, insn);
+            ULONGEST val = tricore_insn_operand (op, 1, insn);
+
+            if (match->kind == TRICORE_PI_MOVH_D)
+              val <<= 16;
+            d_known[d] = true;
+            d_val[d] = val & 0xffffffff;
+          }
+          break;
+
+        case TRICORE_PI_STORE:
+          {
+            int base = tricore_insn_operand (op, 0, insn);
+
+            if (base != 10 && (base != 14 || !p->has_fp))
+              goto done;
+            in_prologue = true;
+          }
+          break;
+
+        case TRICORE_PI_SVLCX:
+          p->saves_lower = true;
+          in_prologue = true;
+          break;
+        }
+
+      if (in_prologue)
+        p->end = next_pc;
+      pc = next_pc;
+    }
+
+ done:
+  /* Forget about any adjustment past the end of the prologue; the scan
+     may have run into the body of a function without a frame.  */
+  while (!p->adjustments.empty () && p->adjustments.back ().first >= p->end)
+    p->adjustments.pop_back ();
+  if (p->has_fp && p->fp_addr >= p->end)
+    p->has_fp = false;
+}
+
+/* Return the prologue analysis of the function starting at START and
+   ending at END (or 0 if unknown), using the cache of the objfile
+   containing it when possible.  SCRATCH holds the result otherwise.  */
+static const struct tricore_prologue &
+tricore_get_prologue (struct gdbarch *gdbarch, CORE_ADDR start,
+                      CORE_ADDR end, struct tricore_prologue &scratch)
+{
+  struct obj_section *osect = find_pc_section (start);
+  tricore_prologue_map *map = nullptr;
+  CORE_ADDR limit = end != 0 ? end : start + TRICORE_MAX_PROLOGUE_INSNS * 4;
+
+  if (osect != nullptr && osect->objfile != nullptr)
+    {
+      map = tricore_prologue_key.get (osect->objfile);
+      if (map == nullptr)
+        map = tricore_prologue_key.emplace (osect->objfile);
+
+      auto it = map->find (start);
+      if (it != map->end ())
+        return it->second;
+    }
+
+  tricore_analyze_prologue (gdbarch, start, limit, &scratch);
+  if (map == nullptr || scratch.incomplete)
+    return scratch;
+
+  return map->emplace (start, std::move (scratch)).first->second;
+}
+
+/* Return the number of bytes of stack the prologue P has allocated by the
+   time execution reaches PC.  */
+static LONGEST
+tricore_prologue_frame_size (const struct tricore_prologue &p, CORE_ADDR pc)
+{
+  LONGEST size = 0;
+
+  for (const auto &adj : p.adjustments)
+    if (adj.first < pc)
+      size += adj.second;
+  return size;
+}
+
 static CORE_ADDR
 tricore_skip_prologue (struct gdbarch *gdbarch, CORE_ADDR ip)
 {
-  /* TODO: Find addi instruction to a10 */
-  return ip;
+  CORE_ADDR func_addr, func_end;
+  struct tricore_prologue scratch;
+
+  if (find_pc_partial_function (ip, NULL, &func_addr, &func_end))
+    {
+      const struct tricore_prologue &p
+          = tricore_get_prologue (gdbarch, func_addr, func_end, scratch);
+
+      return std::max (ip, p.end);
+    }
+
+  tricore_analyze_prologue (gdbarch, ip,
+                            ip + TRICORE_MAX_PROLOGUE_INSNS * 4, &scratch);
+  return scratch.end;
 }
 
 static CORE_ADDR
@@ -109,15 +583,90 @@ tricore_push_dummy_call (struct gdbarch *gdbarch, struct value *function,
   return sp;
 }
 
-struct tricore_unwind_cache
+/* Size in bytes of one CSA (context save area) block.  Both upper and
+   lower contexts occupy sixteen words.  */
+#define TRICORE_CSA_SIZE 64
+
+/* Registers held in each word of an upper and a lower context.  */
+static const int tricore_upper_context_regs[TRICORE_CSA_SIZE / 4] = {
+  TRICORE_PCX_REGNUM, TRICORE_PSW_REGNUM, TRICORE_A10_REGNUM,
+  TRICORE_A11_REGNUM, TRICORE_D8_REGNUM,  TRICORE_D9_REGNUM,
+  TRICORE_D10_REGNUM, TRICORE_D11_REGNUM, TRICORE_A12_REGNUM,
+  TRICORE_A13_REGNUM, TRICORE_A14_REGNUM, TRICORE_A15_REGNUM,
+  TRICORE_D12_REGNUM, TRICORE_D13_REGNUM, TRICORE_D14_REGNUM,
+  TRICORE_D15_REGNUM,
+};
+
+static const int tricore_lower_context_regs[TRICORE_CSA_SIZE / 4] = {
+  TRICORE_PCX_REGNUM, TRICORE_A11_REGNUM, TRICORE_A2_REGNUM,
+  TRICORE_A3_REGNUM,  TRICORE_D0_REGNUM,  TRICORE_D1_REGNUM,
+  TRICORE_D2_REGNUM,  TRICORE_D3_REGNUM,  TRICORE_A4_REGNUM,
+  TRICORE_A5_REGNUM,  TRICORE_A6_REGNUM,  TRICORE_A7_REGNUM,
+  TRICORE_D4_REGNUM,  TRICORE_D5_REGNUM,  TRICORE_D6_REGNUM,
+  TRICORE_D7_REGNUM,
+};
+
+/* Convert a PCXI link word into the address of the CSA it points to.  */
+static CORE_ADDR
+tricore_csa_address (ULONGEST pcx)
 {
+  return ((pcx & 0xF0000) << 12) | ((pcx & 0xFFFF) << 6);
+}
 
-  /* The base (stack) address for this frame.  This is the stack pointer
-      value on entry to this frame before any adjustments are made.  */
+/* Whether the PCXI link word PCX refers to an upper context.  */
+static bool
+tricore_csa_upper_p (ULONGEST pcx)
+{
+  return (pcx & 0x100000) != 0;
+}
+
+/* Statistics of the CSA block reads done by the unwinder, reported by
+   "maint info tricore-csa-cache".  */
+struct tricore_csa_stats
+{
+  /* Caller registers served from a block already read.  */
+  ULONGEST hits = 0;
+
+  /* Blocks read from the target.  */
+  ULONGEST misses = 0;
+  ULONGEST bytes_read = 0;
+};
+
+static tricore_csa_stats csa_stats;
+
+/* Implement "maint info tricore-csa-cache".  */
+
+static void
+maintenance_info_tricore_csa_cache (const char *args, int from_tty)
+{
+  gdb_printf (_("TriCore CSA cache:\n"));
+  gdb_printf (_("  hits:       %s\n"), pulongest (csa_stats.hits));
+  gdb_printf (_("  misses:     %s\n"), pulongest (csa_stats.misses));
+  gdb_printf (_("  bytes read: %s\n"),
+              pulongest (csa_stats.bytes_read));
+}
+
+struct tricore_unwind_cache
+{
+  /* The PCXI of this frame, linking to the context saved by the call
+     into it.  */
   CORE_ADDR pcx;
 
+  /* The base (stack) address for this frame.  This is the stack pointer
+     value on entry to this frame before any adjustments are made.  */
   CORE_ADDR frame_ptr;
 
+  /* Address of the CSA block PCX links to.  */
+  CORE_ADDR context;
+
+  /* The CSA block at CONTEXT, or NULL if it has not been read yet.  It
+     is only read once a caller register is actually wanted, so computing
+     a frame ID never touches memory.  Like the rest of this cache it
+     lives on the frame obstack, so it is dropped together with the frame
+     cache whenever the inferior resumes, memory or registers are
+     written, or another inferior or target is selected.  */
+  gdb_byte *block;
+
   /* Information about previous register values.  */
   trad_frame_saved_reg *regs;
 
@@ -129,8 +678,6 @@ static struct tricore_unwind_cache *
 tricore_frame_cache (frame_info_ptr this_frame, void **this_cache)
 {
   struct tricore_unwind_cache *cache;
-  // struct gdbarch *gdbarch = get_frame_arch (this_frame);
-  // int numregs, regno;
 
   if ((*this_cache) != NULL)
     return (struct tricore_unwind_cache *)*this_cache;
@@ -144,49 +691,62 @@ tricore_frame_cache (frame_info_ptr this_frame, void **this_cache)
     {
       return cache;
     }
-  CORE_ADDR context
-      = ((cache->pcx & 0xF0000) << 12) | ((cache->pcx & 0xFFFF) << 6);
 
-  cache->regs[TRICORE_PC_REGNUM].set_realreg (TRICORE_A11_REGNUM);
-  if (cache->pcx & 0x100000)
+  /* Work out the stack pointer on entry from how much of the prologue has
+     run, or from the frame pointer once it is set up.  */
+  struct gdbarch *gdbarch = get_frame_arch (this_frame);
+  CORE_ADDR func = get_frame_func (this_frame);
+  CORE_ADDR pc = get_frame_pc (this_frame);
+
+  cache->frame_ptr
+      = get_frame_register_unsigned (this_frame, TRICORE_A10_REGNUM);
+  if (func != 0)
     {
-      cache->regs[TRICORE_PCX_REGNUM].set_addr (context);
-      cache->regs[TRICORE_PSW_REGNUM].set_addr (context + 0x4);
-      cache->regs[TRICORE_A10_REGNUM].set_addr (context + 0x8);
-      cache->regs[TRICORE_A11_REGNUM].set_addr (context + 0xC);
-      cache->regs[TRICORE_D8_REGNUM].set_addr (context + 0x10);
-      cache->regs[TRICORE_D9_REGNUM].set_addr (context + 0x14);
-      cache->regs[TRICORE_D10_REGNUM].set_addr (context + 0x18);
-      cache->regs[TRICORE_D11_REGNUM].set_addr (context + 0x1C);
-      cache->regs[TRICORE_A12_REGNUM].set_addr (context + 0x20);
-      cache->regs[TRICORE_A13_REGNUM].set_addr (context + 0x24);
-      cache->regs[TRICORE_A14_REGNUM].set_addr (context + 0x28);
-      cache->regs[TRICORE_A15_REGNUM].set_addr (context + 0x2C);
-      cache->regs[TRICORE_D12_REGNUM].set_addr (context + 0x30);
-      cache->regs[TRICORE_D13_REGNUM].set_addr (context + 0x34);
-      cache->regs[TRICORE_D14_REGNUM].set_addr (context + 0x38);
-      cache->regs[TRICORE_D15_REGNUM].set_addr (context + 0x3C);
+      struct tricore_prologue scratch;
+      CORE_ADDR func_end = 0;
+
+      find_pc_partial_function (func, NULL, NULL, &func_end);
+      const struct tricore_prologue &p
+          = tricore_get_prologue (gdbarch, func, func_end, scratch);
+
+      if (p.has_fp && pc > p.fp_addr)
+        cache->frame_ptr
+            = (get_frame_register_unsigned (this_frame, TRICORE_A14_REGNUM)
+               + p.fp_offset);
+      else
+        cache->frame_ptr += tricore_prologue_frame_size (p, pc);
     }
-  else
+  cache->context = tricore_csa_address (cache->pcx);
+
+  cache->regs[TRICORE_PC_REGNUM].set_realreg (TRICORE_A11_REGNUM);
+  const int *regs = (tricore_csa_upper_p (cache->pcx)
+                     ? tricore_upper_context_regs
+                     : tricore_lower_context_regs);
+  for (int i = 0; i < TRICORE_CSA_SIZE / 4; i++)
+    cache->regs[regs[i]].set_addr (cache->context + i * 4);
+  return cache;
+}
+
+/* Return the CSA block of CACHE, reading it from the target with a
+   single memory access if that has not been done yet.  Throws on a
+   memory error.  */
+
+static const gdb_byte *
+tricore_frame_csa_block (struct tricore_unwind_cache *cache)
+{
+  if (cache->block != NULL)
     {
-      cache->regs[TRICORE_PCX_REGNUM].set_addr (context);
-      cache->regs[TRICORE_A11_REGNUM].set_addr (context + 0x4);
-      cache->regs[TRICORE_A2_REGNUM].set_addr (context + 0x8);
-      cache->regs[TRICORE_A3_REGNUM].set_addr (context + 0xC);
-      cache->regs[TRICORE_D0_REGNUM].set_addr (context + 0x10);
-      cache->regs[TRICORE_D1_REGNUM].set_addr (context + 0x14);
-      cache->regs[TRICORE_D2_REGNUM].set_addr (context + 0x18);
-      cache->regs[TRICORE_D3_REGNUM].set_addr (context + 0x1C);
-      cache->regs[TRICORE_A4_REGNUM].set_addr (context + 0x20);
-      cache->regs[TRICORE_A5_REGNUM].set_addr (context + 0x24);
-      cache->regs[TRICORE_A6_REGNUM].set_addr (context + 0x28);
-      cache->regs[TRICORE_A7_REGNUM].set_addr (context + 0x2C);
-      cache->regs[TRICORE_D4_REGNUM].set_addr (context + 0x30);
-      cache->regs[TRICORE_D5_REGNUM].set_addr (context + 0x34);
-      cache->regs[TRICORE_D6_REGNUM].set_addr (context + 0x38);
-      cache->regs[TRICORE_D7_REGNUM].set_addr (context + 0x3C);
+      csa_stats.hits++;
+      return cache->block;
     }
-  return cache;
+
+  gdb_byte *block = FRAME_OBSTACK_CALLOC (TRICORE_CSA_SIZE, gdb_byte);
+
+  read_memory (cache->context, block, TRICORE_CSA_SIZE);
+  csa_stats.misses++;
+  csa_stats.bytes_read += TRICORE_CSA_SIZE;
+  cache->block = block;
+  return block;
 }
 
 static void
@@ -200,13 +760,21 @@ tricore_frame_this_id (frame_info_ptr this_frame, void **this_cache,
   if (cache->pcx == 0)
     return;
 
-  CORE_ADDR code_addr = get_frame_func (this_frame);
-  if (code_addr == 0)
-    code_addr = get_frame_register_unsigned (this_frame,
-                                             gdbarch_pc_regnum (gdbarch));
+  if (!frame_id_p (cache->this_id))
+    {
+      CORE_ADDR code_addr = get_frame_func (this_frame);
+      if (code_addr == 0)
+        code_addr = get_frame_register_unsigned (this_frame,
+                                                 gdbarch_pc_regnum (gdbarch));
+
+      /* A call does not move the stack pointer, so recursive calls of a
+         function without a stack frame share the same stack address; the
+         PCXI tells them apart.  */
+      cache->this_id
+          = frame_id_build_special (cache->frame_ptr, code_addr, cache->pcx);
+    }
 
-  (*this_id)
-      = frame_id_build_special (cache->frame_ptr, code_addr, cache->pcx);
+  (*this_id) = cache->this_id;
 }
 
 static struct value *
@@ -217,6 +785,28 @@ tricore_frame_prev_register (frame_info_ptr this_frame, void **this_cache,
   struct tricore_unwind_cache *cache
       = tricore_frame_cache (this_frame, this_cache);
 
+  /* The caller registers saved in the CSA remain lvalues at their CSA
+     address, so that they can be assigned to and "info frame" lists
+     where they are saved; but their contents come from the block read
+     once for all of them.  */
+  if (cache->pcx != 0 && cache->regs[prev_regnum].is_addr ())
+    {
+      struct type *type
+          = register_type (get_frame_arch (this_frame), prev_regnum);
+      CORE_ADDR addr = cache->regs[prev_regnum].addr ();
+
+      if (addr >= cache->context
+          && addr + type->length () <= cache->context + TRICORE_CSA_SIZE)
+        {
+          const gdb_byte *block = tricore_frame_csa_block (cache);
+          struct value *v = value_from_contents_and_address (
+              type, block + (addr - cache->context), addr);
+
+          v->set_stack (true);
+          return v;
+        }
+    }
+
   return trad_frame_get_prev_register (this_frame, cache->regs, prev_regnum);
 }
 
@@ -443,8 +1033,10 @@ tricore_gdbarch_init (struct gdbarch_info info, struct gdbarch_list *arches)
         return NULL;
     }
 
-  gdbarch *gdbarch
-      = gdbarch_alloc (&info, gdbarch_tdep_up (new tricore_gdbarch_tdep));
+  tricore_gdbarch_tdep *tdep = new tricore_gdbarch_tdep;
+  tricore_init_prologue_insns (tdep, info.bfd_arch_info->mach);
+
+  gdbarch *gdbarch = gdbarch_alloc (&info, gdbarch_tdep_up (tdep));
   // tricore_gdbarch_tdep *tdep = gdbarch_tdep<tricore_gdbarch_tdep>(gdbarch);
   // const struct target_desc *tdesc = info.target_desc;
 
@@ -557,4 +1149,9 @@ _initialize_tricore_tdep ()
   initialize_tdesc_tricore ();
 
   gdbarch_register (bfd_arch_tricore, tricore_gdbarch_init, NULL);
+
+  add_cmd ("tricore-csa-cache", class_maintenance,
+           maintenance_info_tricore_csa_cache,
+           _("Show statistics of the TriCore CSA (context save area) cache."),
+           &maintenanceinfolist);
 }
\ No newline at end of file
@@ -74,8 +74,21 @@ enum
   TRICORE_PSEUDO_NUM
 };
 
+/* An entry of the TriCore opcode table the prologue analyzer knows
+   about, along with the opcode mask of its format.  KIND is one of the
+   tricore_prologue_kind values in tricore-tdep.c.  */
+struct tricore_prologue_insn
+{
+  const struct tricore_opcode *op;
+  unsigned long mask;
+  int kind;
+};
+
 struct tricore_gdbarch_tdep : gdbarch_tdep_base
 {
+  /* The instructions that may appear in a prologue, for the ISA of this
+     architecture.  */
+  std::vector<tricore_prologue_insn> prologue_insns;
 };
 
 #endif
\ No newline at end of file
@@ -164,6 +164,7 @@ extern unsigned long tricore_mask_ssro;
 extern unsigned long tricore_opmask[];
 
 extern void tricore_init_arch_vars (unsigned long);
+extern int tricore_get_opmask (unsigned long, unsigned long *);
 
 /* This structure describes TriCore opcodes.  */
 
@@ -218,6 +219,16 @@ struct tricore_core_register
 extern const struct tricore_core_register tricore_sfrs[];
 extern const int tricore_numsfrs;
 
+/* Lookups in tricore_opcodes and tricore_sfrs, using perfect hash
+   tables built from them at compile time (see opcodes/tricore-hash.c).  */
+
+extern struct tricore_opcode *tricore_find_opcode (const char *);
+extern const struct tricore_core_register *tricore_find_sfr (const char *,
+							    tricore_isa);
+extern const struct tricore_core_register *
+  tricore_find_sfr_addr (unsigned long, tricore_isa);
+extern const char *tricore_check_hash_tables (void);
+
 /* Kinds of operands for TriCore instructions:
    d  A simple data register (%d0-%d15).
    g  A simple data register with an 'l' suffix.
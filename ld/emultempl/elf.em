@@ -574,7 +574,8 @@ enum elf_options
   OPTION_BUILD_ID,
   OPTION_PACKAGE_METADATA,
   OPTION_AUDIT,
-  OPTION_COMPRESS_DEBUG
+  OPTION_COMPRESS_DEBUG,
+  OPTION_COMPRESS_DEBUG_THREADS
 };
 
 static void
@@ -605,6 +606,7 @@ fragment <<EOF
     {"build-id", optional_argument, NULL, OPTION_BUILD_ID},
     {"package-metadata", optional_argument, NULL, OPTION_PACKAGE_METADATA},
     {"compress-debug-sections", required_argument, NULL, OPTION_COMPRESS_DEBUG},
+    {"compress-debug-threads", required_argument, NULL, OPTION_COMPRESS_DEBUG_THREADS},
 EOF
 if test x"$GENERATE_SHLIB_SCRIPT" = xyes; then
 fragment <<EOF
@@ -673,6 +675,18 @@ gld${EMULATION_NAME}_handle_option (int optc)
 	einfo (_("%F%P: invalid --compress-debug-sections option: \`%s'\n"),
 	       optarg);
       break;
+
+    case OPTION_COMPRESS_DEBUG_THREADS:
+      {
+	char *end;
+	unsigned long threads = strtoul (optarg, &end, 0);
+
+	if (*optarg == '\0' || *end != '\0' || threads > 1024)
+	  einfo (_("%F%P: invalid --compress-debug-threads option: \`%s'\n"),
+		 optarg);
+	bfd_set_compression_threads (threads);
+      }
+      break;
 EOF
 
 if test x"$GENERATE_SHLIB_SCRIPT" = xyes; then
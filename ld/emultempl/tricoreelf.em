@@ -199,9 +199,10 @@ extern bool tricore_elf32_relax_24rel;
 extern bool tricore_elf32_debug_relax;
 extern bool tricore_elf32_disass_report;
 extern bool tricore_elf32_callinfo_report;
+extern bool tricore_elf32_stats;
 extern bool tricore_elf32_nofcallfret;
 
-extern void tricore_elf32_list_bit_objects (struct bfd_link_info *, FILE *);
+extern bool tricore_elf32_list_bit_objects (struct bfd_link_info *, FILE *);
 extern int tricore_elf32_pcpmap;
 extern int tricore_relax_before_alloc;
 extern int tricore_elf32_debug_pcpmap;
@@ -356,8 +357,9 @@ SDA_${EMULATION_NAME}_after_parse ()
 static void
 tricore_elf32_finish (void)
 {
-  if (config.map_file)
-     tricore_elf32_list_bit_objects (&link_info, config.map_file);
+  if (config.map_file
+      && !tricore_elf32_list_bit_objects (&link_info, config.map_file))
+    einfo (_("%P%F: error: cannot list bit objects: %E\n"));
 
   finish_default ();
 }
@@ -382,6 +384,7 @@ SDA_${EMULATION_NAME}_before_allocation ()
     ENABLE_RELAXATION;
 
     tricore_relax_before_alloc = 0;
+    tricore_elf32_stats = config.stats;
 
   /* GNU ld supports relaxing in a very general sense, meaning it's
      completely up to the backend to decide what changes it wants to
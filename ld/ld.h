@@ -84,6 +84,11 @@ name_list;
 
 typedef enum {sort_none, sort_ascending, sort_descending} sort_order;
 
+typedef enum
+{
+  time_report_none, time_report_table, time_report_json
+} time_report_type;
+
 /* A wildcard specification.  */
 
 typedef enum
@@ -265,6 +270,10 @@ typedef struct
 
   bool stats;
 
+  /* If not time_report_none, print the time spent in each phase of
+     the link.  */
+  time_report_type time_report;
+
   /* If set, orphan input sections will be mapped to separate output
      sections.  */
   bool unique_orphan_sections;
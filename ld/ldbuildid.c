@@ -35,7 +35,8 @@ bool
 validate_build_id_style (const char *style)
 {
   if ((streq (style, "md5")) || (streq (style, "sha1"))
-      || (streq (style, "uuid")) || (startswith (style, "0x")))
+      || (streq (style, "tree")) || (streq (style, "uuid"))
+      || (startswith (style, "0x")))
     return true;
 
   return false;
@@ -47,7 +48,7 @@ compute_build_id_size (const char *style)
   if (streq (style, "md5") || streq (style, "uuid"))
     return 128 / 8;
 
-  if (streq (style, "sha1"))
+  if (streq (style, "sha1") || streq (style, "tree"))
     return 160 / 8;
 
   if (startswith (style, "0x"))
@@ -93,6 +94,56 @@ read_hex (const char xdigit)
   return 0;
 }
 
+/* The tree style splits the output contents into chunks of
+   BUILD_ID_TREE_CHUNK bytes, computes the SHA1 hash of each chunk and
+   then the SHA1 hash of the chunk hashes.  The chunks do not depend on
+   one another, so they could be hashed in any order.  */
+
+#define BUILD_ID_TREE_CHUNK (64 * 1024)
+
+struct tree_ctx
+{
+  /* The hash of the current chunk, and how many bytes it has seen.  */
+  struct sha1_ctx chunk;
+  size_t chunk_len;
+  /* The hash of the chunk hashes, and how many chunks it has seen.  */
+  struct sha1_ctx top;
+  size_t chunks;
+};
+
+static void
+tree_finish_chunk (struct tree_ctx *ctx)
+{
+  unsigned char digest[160 / 8];
+
+  sha1_finish_ctx (&ctx->chunk, digest);
+  sha1_process_bytes (digest, sizeof (digest), &ctx->top);
+  sha1_init_ctx (&ctx->chunk);
+  ctx->chunk_len = 0;
+  ctx->chunks++;
+}
+
+static void
+tree_process_bytes (const void *buffer, size_t len, void *data)
+{
+  struct tree_ctx *ctx = (struct tree_ctx *) data;
+  const unsigned char *p = (const unsigned char *) buffer;
+
+  while (len != 0)
+    {
+      size_t n = BUILD_ID_TREE_CHUNK - ctx->chunk_len;
+
+      if (n > len)
+	n = len;
+      sha1_process_bytes (p, n, &ctx->chunk);
+      ctx->chunk_len += n;
+      p += n;
+      len -= n;
+      if (ctx->chunk_len == BUILD_ID_TREE_CHUNK)
+	tree_finish_chunk (ctx);
+    }
+}
+
 bool
 generate_build_id (bfd *abfd,
 		   const char *style,
@@ -118,6 +169,22 @@ generate_build_id (bfd *abfd,
 	return false;
       sha1_finish_ctx (&ctx, id_bits);
     }
+  else if (streq (style, "tree"))
+    {
+      struct tree_ctx ctx;
+
+      sha1_init_ctx (&ctx.chunk);
+      sha1_init_ctx (&ctx.top);
+      ctx.chunk_len = 0;
+      ctx.chunks = 0;
+      if (!(*checksum_contents) (abfd, tree_process_bytes, &ctx))
+	return false;
+      /* The last chunk may be short.  An empty output still has one
+	 chunk.  */
+      if (ctx.chunk_len != 0 || ctx.chunks == 0)
+	tree_finish_chunk (&ctx);
+      sha1_finish_ctx (&ctx.top, id_bits);
+    }
   else if (streq (style, "uuid"))
     {
 #ifndef __MINGW32__
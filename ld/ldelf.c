@@ -33,6 +33,7 @@
 #include "ldfile.h"
 #include "ldemul.h"
 #include "ldbuildid.h"
+#include "ldtimer.h"
 #include <ldgram.h>
 #include "elf-bfd.h"
 #ifdef HAVE_GLOB
@@ -1474,7 +1475,9 @@ write_build_id (bfd *abfd)
   bfd_h_put_32 (abfd, NT_GNU_BUILD_ID, &e_note->type);
   memcpy (e_note->name, "GNU", sizeof "GNU");
 
+  ldtimer_start ("build-id");
   generate_build_id (abfd, style, bed->s->checksum_contents, id_bits, size);
+  ldtimer_stop ("build-id");
 
   position = i_shdr->sh_offset + asec->output_offset;
   size = asec->size;
@@ -31,6 +31,7 @@
 #include "ldfile.h"
 #include "ldemul.h"
 #include "ldmain.h"
+#include "ldtimer.h"
 #include "ldemul-list.h"
 
 static ld_emulation_xfer_type *ld_emulation;
@@ -87,13 +88,17 @@ ldemul_before_place_orphans (void)
 void
 ldemul_after_allocation (void)
 {
+  ldtimer_start ("after_allocation");
   ld_emulation->after_allocation ();
+  ldtimer_stop ("after_allocation");
 }
 
 void
 ldemul_before_allocation (void)
 {
+  ldtimer_start ("before_allocation");
   ld_emulation->before_allocation ();
+  ldtimer_stop ("before_allocation");
 }
 
 void
@@ -105,7 +110,9 @@ ldemul_set_output_arch (void)
 void
 ldemul_finish (void)
 {
+  ldtimer_start ("finish");
   ld_emulation->finish ();
+  ldtimer_stop ("finish");
 }
 
 void
@@ -37,6 +37,7 @@
 #include "ldctor.h"
 #include "ldfile.h"
 #include "ldemul.h"
+#include "ldtimer.h"
 #include "fnmatch.h"
 #include "demangle.h"
 #include "hashtab.h"
@@ -6578,6 +6579,7 @@ lang_size_relro_segment (bool *relax, bool check_regions)
 void
 lang_size_sections (bool *relax, bool check_regions)
 {
+  ldtimer_start ("lang_size_sections");
   expld.phase = lang_allocating_phase_enum;
   expld.dataseg.phase = exp_seg_none;
 
@@ -6603,6 +6605,7 @@ lang_size_sections (bool *relax, bool check_regions)
 	  link_info.relro_end = expld.dataseg.relro_end;
 	}
     }
+  ldtimer_stop ("lang_size_sections");
 }
 
 static lang_output_section_statement_type *current_section;
@@ -7978,6 +7981,8 @@ lang_find_relro_sections (void)
 void
 lang_relax_sections (bool need_layout)
 {
+  ldtimer_start ("lang_relax_sections");
+
   /* NB: Also enable relaxation to layout sections for DT_RELR.  */
   if (RELAXATION_ENABLED || link_info.enable_dt_relr)
     {
@@ -8028,6 +8033,8 @@ lang_relax_sections (bool need_layout)
       lang_reset_memory_regions ();
       lang_size_sections (NULL, true);
     }
+
+  ldtimer_stop ("lang_relax_sections");
 }
 
 #if BFD_SUPPORTS_PLUGINS
@@ -8301,7 +8308,9 @@ lang_process (void)
   /* Create a bfd for each input file.  */
   current_target = default_target;
   lang_statement_iteration++;
+  ldtimer_start ("open_input_bfds");
   open_input_bfds (statement_list.head, OPEN_BFD_NORMAL);
+  ldtimer_stop ("open_input_bfds");
 
   /* Now that open_input_bfds has processed assignments and provide
      statements we can give values to symbolic origin/length now.  */
@@ -8480,7 +8489,9 @@ lang_process (void)
   resolve_wilds ();
 
   /* Remove unreferenced sections if asked to.  */
+  ldtimer_start ("lang_gc_sections");
   lang_gc_sections ();
+  ldtimer_stop ("lang_gc_sections");
 
   lang_mark_undefineds ();
 
@@ -8503,7 +8514,9 @@ lang_process (void)
   /* Run through the contours of the script and attach input sections
      to the correct output sections.  */
   lang_statement_iteration++;
+  ldtimer_start ("map_input_to_output_sections");
   map_input_to_output_sections (statement_list.head, NULL, NULL);
+  ldtimer_stop ("map_input_to_output_sections");
 
   /* Start at the statement immediately after the special abs_section
      output statement, so that it isn't reordered.  */
@@ -8522,7 +8535,9 @@ lang_process (void)
 	 sections, so that GCed sections are not merged, but before
 	 assigning dynamic symbols, since removing whole input sections
 	 is hard then.  */
+      ldtimer_start ("bfd_merge_sections");
       bfd_merge_sections (link_info.output_bfd, &link_info);
+      ldtimer_stop ("bfd_merge_sections");
 
       /* Look for a text section and set the readonly attribute in it.  */
       found = bfd_get_section_by_name (link_info.output_bfd, ".text");
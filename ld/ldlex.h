@@ -66,6 +66,7 @@ enum option_values
   OPTION_SYMBOLIC,
   OPTION_SYMBOLIC_FUNCTIONS,
   OPTION_TASK_LINK,
+  OPTION_TIME_REPORT,
   OPTION_TBSS,
   OPTION_TDATA,
   OPTION_TTEXT,
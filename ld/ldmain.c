@@ -39,6 +39,7 @@
 #include "ldfile.h"
 #include "ldemul.h"
 #include "ldctor.h"
+#include "ldtimer.h"
 #if BFD_SUPPORTS_PLUGINS
 #include "plugin.h"
 #include "plugin-api.h"
@@ -373,6 +374,7 @@ main (int argc, char **argv)
   ldemul_before_parse ();
   lang_has_input_file = false;
   parse_args (argc, argv);
+  ldtimer_start ("link");
 
   if (config.hash_table_size != 0)
     bfd_hash_set_default_size (config.hash_table_size);
@@ -525,10 +527,16 @@ main (int argc, char **argv)
   link_info.output_bfd->flags
     |= flags & bfd_applicable_file_flags (link_info.output_bfd);
 
+  ldtimer_start ("ldwrite");
   ldwrite ();
+  ldtimer_stop ("ldwrite");
 
   if (config.map_file != NULL)
-    lang_map ();
+    {
+      ldtimer_start ("map");
+      lang_map ();
+      ldtimer_stop ("map");
+    }
   if (command_line.cref)
     output_cref (config.map_file != NULL ? config.map_file : stdout);
   if (nocrossref_list != NULL)
@@ -565,8 +573,10 @@ main (int argc, char **argv)
     {
       bfd *obfd = link_info.output_bfd;
       link_info.output_bfd = NULL;
+      ldtimer_start ("close");
       if (!bfd_close (obfd))
 	einfo (_("%F%P: %s: final close failed: %E\n"), output_filename);
+      ldtimer_stop ("close");
 
       /* If the --force-exe-suffix is enabled, and we're making an
 	 executable file and it doesn't end in .exe, copy it to one
@@ -618,13 +628,38 @@ main (int argc, char **argv)
   if (config.stats)
     {
       long run_time = get_run_time () - start_time;
+      const struct bfd_compression_stats *cstats;
+      struct bfd_cache_stats fstats;
 
       fflush (stdout);
       fprintf (stderr, _("%s: total time in link: %ld.%06ld\n"),
 	       program_name, run_time / 1000000, run_time % 1000000);
+      cstats = bfd_get_compression_stats ();
+      if (cstats->sections != 0)
+	fprintf (stderr, _("%s: compressed %u sections: %" PRIu64
+			   " -> %" PRIu64 " bytes (%.1f%%)"
+			   " in %ld.%06ld\n"),
+		 program_name, cstats->sections,
+		 (uint64_t) cstats->uncompressed_size,
+		 (uint64_t) cstats->compressed_size,
+		 (cstats->uncompressed_size == 0 ? 100.0
+		  : 100.0 * cstats->compressed_size
+		    / cstats->uncompressed_size),
+		 cstats->usec / 1000000, cstats->usec % 1000000);
+      bfd_get_cache_stats (&fstats, false);
+      fprintf (stderr, _("%s: file cache: %lu hits, %lu misses, %lu reopens,"
+			 " %lu evictions, at most %d files open\n"),
+	       program_name, fstats.hits, fstats.misses, fstats.reopens,
+	       fstats.evictions, fstats.max_open);
+      if (fstats.mapped_archives != 0)
+	fprintf (stderr, _("%s: mapped %u archives: %" PRIu64 " bytes\n"),
+		 program_name, fstats.mapped_archives,
+		 (uint64_t) fstats.mapped_size);
       fflush (stderr);
     }
 
+  ldtimer_report ();
+
   /* Prevent ld_cleanup from deleting the output file.  */
   output_filename = NULL;
 
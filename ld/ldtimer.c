@@ -0,0 +1,214 @@
+/* ldtimer.c - Per-phase timing for --time-report
+   Copyright (C) 2026 Free Software Foundation, Inc.
+
+   This file is part of the GNU Binutils.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston,
+   MA 02110-1301, USA.  */
+
+#include "sysdep.h"
+#include "bfd.h"
+#include "libiberty.h"
+#include "bfdlink.h"
+#include "ctf-api.h"
+#include "ld.h"
+#include "ldmain.h"
+#include "ldmisc.h"
+#include "ldtimer.h"
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+#if defined (HAVE_SYS_RESOURCE_H) && defined (HAVE_GETRUSAGE)
+#include <sys/resource.h>
+#endif
+#include <time.h>
+
+struct ldtimer_phase
+{
+  const char *name;
+  struct ldtimer_phase *parent;
+  struct ldtimer_phase *children;
+  struct ldtimer_phase **children_tail;
+  struct ldtimer_phase *next;
+  /* Number of times the phase was entered, and the total time spent
+     in it, in microseconds.  */
+  unsigned long count;
+  int64_t wall;
+  long cpu;
+  /* Values at the most recent ldtimer_start.  */
+  int64_t wall_start;
+  long cpu_start;
+  /* Largest peak resident set size seen on leaving the phase, in KiB,
+     or -1 if unknown.  */
+  long max_rss;
+};
+
+/* The unnamed parent of all top-level phases.  */
+static struct ldtimer_phase top_phase =
+  { .children_tail = &top_phase.children };
+
+/* The innermost running phase.  */
+static struct ldtimer_phase *current_phase = &top_phase;
+
+/* The wall clock time in microseconds, which overflows a 32-bit long.  */
+
+static int64_t
+wall_time (void)
+{
+#ifdef HAVE_GETTIMEOFDAY
+  struct timeval tv;
+
+  gettimeofday (&tv, NULL);
+  return (int64_t) tv.tv_sec * 1000000 + tv.tv_usec;
+#else
+  return (int64_t) time (NULL) * 1000000;
+#endif
+}
+
+static long
+peak_rss (void)
+{
+#if defined (HAVE_SYS_RESOURCE_H) && defined (HAVE_GETRUSAGE)
+  struct rusage ru;
+
+  if (getrusage (RUSAGE_SELF, &ru) == 0)
+    return ru.ru_maxrss;
+#endif
+  return -1;
+}
+
+/* Enter phase NAME, as a child of the currently running phase.  */
+
+void
+ldtimer_start (const char *name)
+{
+  struct ldtimer_phase *p;
+
+  if (config.time_report == time_report_none)
+    return;
+
+  for (p = current_phase->children; p != NULL; p = p->next)
+    if (strcmp (p->name, name) == 0)
+      break;
+
+  if (p == NULL)
+    {
+      p = (struct ldtimer_phase *) xcalloc (1, sizeof (*p));
+      p->name = name;
+      p->parent = current_phase;
+      p->children_tail = &p->children;
+      p->max_rss = -1;
+      *current_phase->children_tail = p;
+      current_phase->children_tail = &p->next;
+    }
+
+  p->count++;
+  p->wall_start = wall_time ();
+  p->cpu_start = get_run_time ();
+  current_phase = p;
+}
+
+static void
+stop_phase (struct ldtimer_phase *p)
+{
+  long rss;
+
+  p->wall += wall_time () - p->wall_start;
+  p->cpu += get_run_time () - p->cpu_start;
+  rss = peak_rss ();
+  if (rss > p->max_rss)
+    p->max_rss = rss;
+  current_phase = p->parent;
+}
+
+/* Leave phase NAME, which must be the innermost running phase.  */
+
+void
+ldtimer_stop (const char *name)
+{
+  if (config.time_report == time_report_none)
+    return;
+
+  ASSERT (current_phase != &top_phase
+	  && strcmp (current_phase->name, name) == 0);
+  if (current_phase != &top_phase)
+    stop_phase (current_phase);
+}
+
+static void
+print_table (struct ldtimer_phase *p, int depth)
+{
+  for (; p != NULL; p = p->next)
+    {
+      fprintf (stderr, "%*s%-*s %6lu %4" PRId64 ".%06" PRId64 " %4ld.%06ld",
+	       depth * 2, "", 32 - depth * 2, p->name, p->count,
+	       p->wall / 1000000, p->wall % 1000000,
+	       p->cpu / 1000000, p->cpu % 1000000);
+      if (p->max_rss >= 0)
+	fprintf (stderr, " %12ld", p->max_rss);
+      fputc ('\n', stderr);
+      print_table (p->children, depth + 1);
+    }
+}
+
+static void
+print_json (struct ldtimer_phase *p, int depth)
+{
+  for (; p != NULL; p = p->next)
+    {
+      fprintf (stderr, "%*s{\"name\": \"%s\", \"calls\": %lu,"
+	       " \"wall_usec\": %" PRId64 ", \"cpu_usec\": %ld",
+	       depth * 2, "", p->name, p->count, p->wall, p->cpu);
+      if (p->max_rss >= 0)
+	fprintf (stderr, ", \"max_rss_kib\": %ld", p->max_rss);
+      if (p->children != NULL)
+	{
+	  fprintf (stderr, ",\n%*s \"children\": [\n", depth * 2, "");
+	  print_json (p->children, depth + 1);
+	  fprintf (stderr, "%*s ]", depth * 2, "");
+	}
+      fprintf (stderr, "}%s\n", p->next != NULL ? "," : "");
+    }
+}
+
+/* Stop any phases still running and print the collected times to
+   stderr in the format selected by --time-report.  */
+
+void
+ldtimer_report (void)
+{
+  if (config.time_report == time_report_none)
+    return;
+
+  while (current_phase != &top_phase)
+    stop_phase (current_phase);
+
+  fflush (stdout);
+  if (config.time_report == time_report_json)
+    {
+      fprintf (stderr, "{\"program\": \"%s\",\n \"phases\": [\n",
+	       lbasename (program_name));
+      print_json (top_phase.children, 1);
+      fprintf (stderr, " ]}\n");
+    }
+  else
+    {
+      fprintf (stderr, _("%s: time report\n"), program_name);
+      fprintf (stderr, "%-32s %6s %11s %11s %12s\n", _("phase"),
+	       _("calls"), _("wall"), _("cpu"), _("max rss KiB"));
+      print_table (top_phase.children, 0);
+    }
+  fflush (stderr);
+}
@@ -0,0 +1,38 @@
+/* ldtimer.h -
+   Copyright (C) 2026 Free Software Foundation, Inc.
+
+   This file is part of the GNU Binutils.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston,
+   MA 02110-1301, USA.  */
+
+#ifndef LDTIMER_H
+#define LDTIMER_H
+
+/* Phase timers for --time-report.  Phases nest: a phase started while
+   another is running becomes its child, and restarting a phase under
+   the same parent accumulates into the existing entry.  All of these
+   do nothing unless --time-report was given.  */
+
+extern void
+ldtimer_start (const char *);
+
+extern void
+ldtimer_stop (const char *);
+
+extern void
+ldtimer_report (void);
+
+#endif /* LDTIMER_H */
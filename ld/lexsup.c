@@ -494,6 +494,10 @@ static const struct ld_option ld_options[] =
     '\0', NULL, N_("Display target specific options"), TWO_DASHES },
   { {"task-link", required_argument, NULL, OPTION_TASK_LINK},
     '\0', N_("SYMBOL"), N_("Do task level linking"), TWO_DASHES },
+  { {"time-report", optional_argument, NULL, OPTION_TIME_REPORT},
+    '\0', N_("[=table|json]"),
+    N_("Print time and memory used by each phase of the link"),
+    TWO_DASHES },
   { {"traditional-format", no_argument, NULL, OPTION_TRADITIONAL_FORMAT},
     '\0', NULL, N_("Use same format as native linker"), TWO_DASHES },
   { {"section-start", required_argument, NULL, OPTION_SECTION_START},
@@ -1370,6 +1374,15 @@ parse_args (unsigned argc, char **argv)
 	case OPTION_STATS:
 	  config.stats = true;
 	  break;
+	case OPTION_TIME_REPORT:
+	  if (optarg == NULL
+	      || strcmp (optarg, "table") == 0)
+	    config.time_report = time_report_table;
+	  else if (strcmp (optarg, "json") == 0)
+	    config.time_report = time_report_json;
+	  else
+	    einfo (_("%F%P: invalid --time-report format: %s\n"), optarg);
+	  break;
 	case OPTION_NO_SYMBOLIC:
 	  opt_symbolic = symbolic_unset;
 	  break;
@@ -2216,6 +2229,8 @@ elf_static_list_options (FILE *file)
                                 Default: %s\n"),
 	   bfd_get_compression_algorithm_name (config.compress_debug));
   fprintf (file, _("\
+  --compress-debug-threads=N  Compress large zstd sections on at most N threads\n"));
+  fprintf (file, _("\
   -z common-page-size=SIZE    Set common page size to SIZE\n"));
   fprintf (file, _("\
   -z max-page-size=SIZE       Set maximum page size to SIZE\n"));
@@ -0,0 +1,4 @@
+	.data
+	.globl	arorder_c1
+arorder_c1:
+	.dc.a	arorder_c2
@@ -0,0 +1,4 @@
+	.data
+	.globl	arorder_c2
+arorder_c2:
+	.dc.a	arorder_c3
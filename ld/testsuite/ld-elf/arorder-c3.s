@@ -0,0 +1,4 @@
+	.data
+	.globl	arorder_c3
+arorder_c3:
+	.dc.a	arorder_c4
@@ -0,0 +1,4 @@
+	.data
+	.globl	arorder_c4
+arorder_c4:
+	.dc.a	0
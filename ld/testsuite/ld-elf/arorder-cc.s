@@ -0,0 +1,6 @@
+	.comm	arorder_com, 4, 4
+
+	.data
+	.globl	arorder_q
+arorder_q:
+	.dc.a	arorder_com
@@ -0,0 +1,7 @@
+	.data
+	.p2align 2
+	.globl	arorder_com
+	.type	arorder_com, %object
+	.size	arorder_com, 4
+arorder_com:
+	.long	1
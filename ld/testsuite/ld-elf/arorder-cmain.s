@@ -0,0 +1,7 @@
+	.text
+	.globl	_start
+_start:
+	.long	0
+
+	.data
+	.dc.a	arorder_q
@@ -0,0 +1,5 @@
+# The link fails if this member is included.
+	.data
+	.globl	arorder_cx
+arorder_cx:
+	.dc.a	arorder_undefined
@@ -0,0 +1,4 @@
+	.data
+	.globl	arorder_ga1
+arorder_ga1:
+	.dc.a	arorder_gb1
@@ -0,0 +1,4 @@
+	.data
+	.globl	arorder_ga2
+arorder_ga2:
+	.dc.a	0
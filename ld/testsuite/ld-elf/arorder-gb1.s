@@ -0,0 +1,4 @@
+	.data
+	.globl	arorder_gb1
+arorder_gb1:
+	.dc.a	arorder_ga2
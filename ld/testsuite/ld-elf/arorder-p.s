@@ -0,0 +1,4 @@
+	.data
+	.globl	arorder_p
+arorder_p:
+	.dc.a	arorder_w
@@ -0,0 +1,4 @@
+	.data
+	.globl	arorder_w
+arorder_w:
+	.dc.a	0
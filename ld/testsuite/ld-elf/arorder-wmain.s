@@ -0,0 +1,11 @@
+	.text
+	.globl	_start
+_start:
+	.long	0
+
+	.data
+	.weak	arorder_w
+	.weak	arorder_wx
+	.dc.a	arorder_w
+	.dc.a	arorder_wx
+	.dc.a	arorder_p
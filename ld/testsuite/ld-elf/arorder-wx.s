@@ -0,0 +1,5 @@
+# The link fails if this member is included.
+	.data
+	.globl	arorder_wx
+arorder_wx:
+	.dc.a	arorder_undefined
@@ -0,0 +1,3 @@
+# Enough data for several --build-id=tree chunks.
+	.data
+	.fill	0x28000, 1, 0x5a
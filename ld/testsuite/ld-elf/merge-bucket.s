@@ -0,0 +1,24 @@
+# More than 1024 strings, so that the suffix merge sorts them in
+# buckets.  Each two-character string is a suffix of sixteen of the
+# three-character strings and each one-character string of 256.
+	.section .rodata.str1.1,"aMS","progbits",1
+	.irp a,0,1,2,3,4,5,6,7,8,9,a,b,c,d,e,f
+	.irp b,0,1,2,3,4,5,6,7,8,9,a,b,c,d,e,f
+	.irp c,0,1,2,3,4,5,6,7
+	.asciz	"\a\b\c"
+	.asciz	"\b\c"
+	.asciz	"\c"
+	.endr
+	.endr
+	.endr
+.LC0:
+	.asciz	"f37"
+.LC1:
+	.asciz	"37"
+.LC2:
+	.asciz	"7"
+
+	.data
+	.long	.LC0
+	.long	.LC1
+	.long	.LC2
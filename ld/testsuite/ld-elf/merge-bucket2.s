@@ -0,0 +1,23 @@
+# Like merge-bucket.s, but with two-byte characters.
+	.section .rodata.str2.2,"aMS","progbits",2
+	.balign	2
+	.irp a,0,1,2,3,4,5,6,7,8,9,a,b,c,d,e,f
+	.irp b,0,1,2,3,4,5,6,7,8,9,a,b,c,d,e,f
+	.irp c,0,1,2,3,4,5,6,7
+	.2byte	0x10\a, 0x20\b, 0x30\c, 0
+	.2byte	0x20\b, 0x30\c, 0
+	.2byte	0x30\c, 0
+	.endr
+	.endr
+	.endr
+.LC0:
+	.2byte	0x10f, 0x203, 0x307, 0
+.LC1:
+	.2byte	0x203, 0x307, 0
+.LC2:
+	.2byte	0x307, 0
+
+	.data
+	.long	.LC0
+	.long	.LC1
+	.long	.LC2
@@ -0,0 +1,25 @@
+# Like merge-bucket.s, but with strings aligned to four bytes, so
+# that a string can only be merged at a multiple of four from the
+# start of a longer one.
+	.section .rodata.str1.4,"aMS","progbits",1
+	.balign	4
+	.irp a,0,1,2,3,4,5,6,7,8,9,a,b,c,d,e,f
+	.irp b,0,1,2,3,4,5,6,7,8,9,a,b,c,d,e,f
+	.irp c,0,1,2,3,4,5,6,7
+	.asciz	"\a\b--\c!"
+	.balign	4
+	.asciz	"\c!"
+	.balign	4
+	.endr
+	.endr
+	.endr
+.LC0:
+	.asciz	"f3--7!"
+	.balign	4
+.LC1:
+	.asciz	"7!"
+	.balign	4
+
+	.data
+	.long	.LC0
+	.long	.LC1
@@ -0,0 +1,9 @@
+# A 3 MiB debug section.  The linker compresses a section this large
+# in several zstd jobs, which may run on any number of threads.
+
+	.section .debug_info,"",%progbits
+	.set	k, 0
+	.rept	48
+	.fill	65536, 1, k
+	.set	k, k + 1
+	.endr
@@ -0,0 +1,35 @@
+	.globl _start
+_start:
+	.dc.a	a0
+
+	.section .data.a0,"aw",%progbits
+a0:
+	.dc.a	a1
+	.section .data.a1,"aw",%progbits
+a1:
+	.dc.a	a2
+	.section .data.a2,"aw",%progbits
+a2:
+	.dc.a	a3
+	.section .data.a3,"aw",%progbits
+a3:
+	.dc.a	a1
+	.dc.a	g1
+
+	.section .data.g1,"awG",%progbits,grp,comdat
+g1:
+	.long	1
+	.section .data.g2,"awG",%progbits,grp,comdat
+g2:
+	.dc.a	a4
+
+	.section .data.a4,"aw",%progbits
+a4:
+	.long	4
+
+	.section .data.d0,"aw",%progbits
+d0:
+	.dc.a	d1
+	.section .data.d1,"aw",%progbits
+d1:
+	.dc.a	a0
@@ -812,6 +812,10 @@ disassemble_free_target (struct disassemble_info *info)
 #ifdef ARCH_rs6000
     case bfd_arch_rs6000:
       break;
+#endif
+#ifdef ARCH_tricore
+    case bfd_arch_tricore:
+      break;
 #endif
     }
 
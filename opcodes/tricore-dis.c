@@ -33,9 +33,9 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.  */
 #define NUMSFRS tricore_numsfrs
 // TODO #define NUMPCPOPCS pcp_numopcodes
 #define MAX_OPS 5
-#define MATCHES_ISA(isa) \
+#define MATCHES_ISA(isa, cur_isa) \
 	  (((isa) == TRICORE_GENERIC) \
-	   || ((isa & TRICORE_ISA_MASK) & current_isa))
+	   || (((isa) & TRICORE_ISA_MASK) & (cur_isa)))
 
 /* Some handy shortcuts.  */
 
@@ -43,19 +43,37 @@ typedef struct tricore_opcode opcode_t;
 // TODO typedef struct pcp_opcode pcp_opcode_t;
 typedef const struct tricore_core_register sfr_t;
 
-/* For faster lookup, we hash instruction opcodes and SFRs.  */
+/* For faster lookup, instructions are dispatched on their primary
+   opcode, and SFRs are hashed.  */
 
-struct insnlist
+/* An operand field is made of up to four bit-fields of the instruction
+   word; its value is the OR of ((insn & mask[i]) >> rshift[i]) << lshift[i].
+   IS_REG tells whether the value is a register number (stored in
+   decoded_insn.regs) or a constant (stored in decoded_insn.cexp).  */
+
+#define MAX_FIELD_PIECES 4
+
+struct field_extractor
 {
-  opcode_t *code;
-  struct insnlist *next;
+  unsigned char is_reg;
+  unsigned char npieces;
+  unsigned char rshift[MAX_FIELD_PIECES];
+  unsigned char lshift[MAX_FIELD_PIECES];
+  unsigned long mask[MAX_FIELD_PIECES];
 };
 
-/* TriCore insns have only 6 significant bits (because of the 16-bit
-   SRRS format), so the hash table needs being restricted to 64 entries.  */
+/* A candidate instruction for a given primary opcode, along with all
+   that is needed to match and decode it.  */
+
+struct insn_decoder
+{
+  opcode_t *code;
+  unsigned long mask;		/* tricore_opmask[code->format].  */
+  int nfields;			/* Number of entries in FIELDS.  */
+  signed char operand[MAX_OPS];	/* Operand number of each field.  */
+  struct field_extractor fields[MAX_OPS];
+};
 
-static struct insnlist *insns[64];
-static struct insnlist *insnlink;
 
 #if 0
 TODO
@@ -72,24 +90,46 @@ static struct pcplist *pcplink;
 
 #endif
 
-/* The hash key for SFRs is their LSB.  */
+/* The lookup tables for one TriCore instruction set architecture.
+   They are built the first time an ISA is needed, and are never
+   changed afterwards, so they can be shared by any number of
+   disassemblers, even if these are running in different threads.  */
 
-struct sfrlist
+struct tricore_dis_tables
 {
-  sfr_t *sfr;
-  struct sfrlist *next;
+  /* The candidates for primary opcode OP (the low byte of an insn) are
+     decoders[dispatch[OP]] to decoders[dispatch[OP + 1] - 1], in the
+     order in which they are tried.  The low byte also tells the length
+     of an insn, so there's no need to check for it at runtime.  */
+  struct insn_decoder *decoders;
+  unsigned int dispatch[257];
 };
 
-static struct sfrlist *sfrs[256];
-static struct sfrlist *sfrlink;
+/* The TriCore flavours we know of; the tables of flavour I are
+   dis_tables[I], and its ISA is tricore_isas[I].  */
 
-/* 1 if the hash tables are initialized.  */
+static const tricore_isa tricore_isas[] =
+{
+  TRICORE_RIDER_A, TRICORE_V1_2, TRICORE_V1_3, TRICORE_V1_3_1,
+  TRICORE_V1_6, TRICORE_V1_6_1, TRICORE_V1_6_2, TRICORE_V1_8
+};
 
-static int initialized = 0;
+#define NUM_ISAS (sizeof (tricore_isas) / sizeof (tricore_isas[0]))
 
-/* Which TriCore instruction set architecture are we dealing with?  */
+static const struct tricore_dis_tables *dis_tables[NUM_ISAS];
 
-static tricore_isa current_isa = TRICORE_V1_2;
+/* Tables are published with a compare-and-swap, so that concurrent
+   first uses of an ISA agree on one copy.  */
+
+#ifdef __GNUC__
+#define LOAD_TABLES(p) __atomic_load_n (&(p), __ATOMIC_ACQUIRE)
+#define PUBLISH_TABLES(p, old, new) \
+  __atomic_compare_exchange_n (&(p), &(old), (new), false, \
+			       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#else
+#define LOAD_TABLES(p) (p)
+#define PUBLISH_TABLES(p, old, new) ((p) = (new), true)
+#endif
 
 /* If we can find the instruction matching a given opcode, we decode
    its operands and store them in the following structure.  */
@@ -102,1008 +142,414 @@ struct decoded_insn
   unsigned long long cexp[MAX_OPS];
 };
 
-static struct decoded_insn dec_insn;
-
-/* Forward declarations of decoding functions.  */
-
-static void decode_abs (void);
-static void decode_absb (void);
-static void decode_b (void);
-static void decode_bit (void);
-static void decode_bo (void);
-static void decode_bol (void);
-static void decode_brc (void);
-static void decode_brn (void);
-static void decode_brr (void);
-static void decode_rc (void);
-static void decode_rcpw (void);
-static void decode_rcr (void);
-static void decode_rcrr (void);
-static void decode_rcrw (void);
-static void decode_rlc (void);
-static void decode_rr (void);
-static void decode_rr1 (void);
-static void decode_rr2 (void);
-static void decode_rrpw (void);
-static void decode_rrr (void);
-static void decode_rrr1 (void);
-static void decode_rrr2 (void);
-static void decode_rrrr (void);
-static void decode_rrrw (void);
-static void decode_sys (void);
-static void decode_sb (void);
-static void decode_sbc (void);
-static void decode_sbr (void);
-static void decode_sbrn (void);
-static void decode_sc (void);
-static void decode_slr (void);
-static void decode_slro (void);
-static void decode_sr (void);
-static void decode_src (void);
-static void decode_sro (void);
-static void decode_srr (void);
-static void decode_srrs (void);
-static void decode_ssr (void);
-static void decode_ssro (void);
-
-/* Array of function pointers to decoding functions.  */
-
-static void (*decode[]) (void) =
+/* The state of a TriCore disassembler, stored in info->private_data.
+   Everything that used to be static is here, so that disassemblers
+   are independent of each other.  */
+
+#define NO_AREG	16
+
+struct tricore_private_data
 {
-  /* 32-bit formats.  */
-  decode_abs, decode_absb, decode_b, decode_bit, decode_bo, decode_bol,
-  decode_brc, decode_brn, decode_brr, decode_rc, decode_rcpw, decode_rcr,
-  decode_rcrr, decode_rcrw, decode_rlc, decode_rr, decode_rr1, decode_rr2,
-  decode_rrpw, decode_rrr, decode_rrr1, decode_rrr2, decode_rrrr,
-  decode_rrrw, decode_sys,
-
-  /* 16-bit formats.  */
-  decode_sb, decode_sbc, decode_sbr, decode_sbrn, decode_sc, decode_slr,
-  decode_slro, decode_sr, decode_src, decode_sro, decode_srr,
-  decode_srrs, decode_ssr, decode_ssro
+  unsigned long mach;		/* info->mach the ISA was derived from.  */
+  tricore_isa isa;		/* Which ISA are we dealing with?  */
+  const struct tricore_dis_tables *tables;
+  struct decoded_insn dec_insn;
+
+  /* State used by print_decoded_insn to track address loads.  */
+  bfd_vma next_addr;
+  bool expect_lea;
+  int load_areg[NO_AREG];
+  unsigned long load_hi_addr[NO_AREG];
+  unsigned long load_addr;
+  bool print_symbolic_address;
 };
 
 /* More forward declarations.  */
 
-static unsigned long extract_off18 (void);
-static void init_hash_tables (void);
-static const char *find_core_reg (unsigned long);
-static void print_decoded_insn (bfd_vma, struct disassemble_info *);
-static int decode_tricore_insn (bfd_vma, unsigned long, int,
-					struct disassemble_info *);
+static struct tricore_dis_tables *init_hash_tables (tricore_isa,
+						   const unsigned long *);
+static const char *find_core_reg (struct tricore_private_data *,
+				  unsigned long);
+static void print_decoded_insn (struct tricore_private_data *, bfd_vma,
+				struct disassemble_info *);
+static int decode_tricore_insn (struct tricore_private_data *, bfd_vma,
+				unsigned long, int,
+				struct disassemble_info *);
 // TODO static int decode_pcp_insn (bfd_vma, bfd_byte [4], struct disassemble_info *);
 
-/* Here come the decoding functions.  If you thought that the encoding
-   functions in the assembler were somewhat, umm,  boring, you should
-   take a serious look at their counterparts below.  They're even more so!
-   *yawn*   */
-
-static unsigned long
-extract_off18 ()
-{
-  unsigned long o1, o2, o3, o4;
-  unsigned long val = dec_insn.opcode;
-
-  o1 = (val & 0x003f0000) >> 16;
-  o2 = (val & 0xf0000000) >> 22;
-  o3 = (val & 0x03c00000) >> 12;
-  o4 = (val & 0x0000f000) << 2;
-  return o1 | o2 | o3 | o4;
-}
-
-static void
-decode_abs ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_ABS_OFF18:
-      case FMT_ABS_OFF18_14:
-        dec_insn.cexp[i] = extract_off18 ();
-        break;
-      
-      case FMT_ABS_S1_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_absb ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_ABSB_OFF18:
-        dec_insn.cexp[i] = extract_off18 ();
-        break;
-
-      case FMT_ABSB_B:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x800) >> 11;
-	break;
-
-      case FMT_ABSB_BPOS3:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x700) >> 8;
-	break;
-      }
-}
-
-static void
-decode_b ()
-{
-  int i;
-  unsigned long o1, o2;
-      
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_B_DISP24:
-        o1 = (dec_insn.opcode & 0xffff0000) >> 16;
-	o2 = (dec_insn.opcode & 0x0000ff00) << 8;
-	dec_insn.cexp[i] = o1 | o2;
-	break;
-      }
-}
-
-static void
-decode_bit ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_BIT_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_BIT_P2:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x0f800000) >> 23;
-	break;
-
-      case FMT_BIT_P1:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x001f0000) >> 16;
-        break;
-
-      case FMT_BIT_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_BIT_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_bo ()
-{
-  int i;
-  unsigned long o1, o2;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_BO_OFF10:
-        o1 = (dec_insn.opcode & 0x003f0000) >> 16;
-	o2 = (dec_insn.opcode & 0xf0000000) >> 22;
-	dec_insn.cexp[i] = o1 | o2;
-        break;
-
-      case FMT_BO_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_BO_S1_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_bol ()
-{
-  int i;
-  unsigned long o1, o2, o3;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_BOL_OFF16:
-        o1 = (dec_insn.opcode & 0x003f0000) >> 16;
-	o2 = (dec_insn.opcode & 0xf0000000) >> 22;
-	o3 = (dec_insn.opcode & 0x0fc00000) >> 12;
-	dec_insn.cexp[i] = o1 | o2 | o3;
-        break;
-
-      case FMT_BOL_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_BOL_S1_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_brc ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_BRC_DISP15:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x7fff0000) >> 16;
-	break;
-
-      case FMT_BRC_CONST4:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_BRC_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_brn ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_BRN_DISP15:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x7fff0000) >> 16;
-	break;
-
-      case FMT_BRN_N:
-        dec_insn.cexp[i] =  (dec_insn.opcode & 0x0000f000) >> 12;
-	dec_insn.cexp[i] |= (dec_insn.opcode & 0x00000080) >> 3;
-	break;
-
-      case FMT_BRN_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_brr ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_BRR_DISP15:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x7fff0000) >> 16;
-	break;
-
-      case FMT_BRR_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_BRR_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rc ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RC_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RC_CONST9:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x001ff000) >> 12;
-	break;
-
-      case FMT_RC_CONST10:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x003ff000) >> 12;
-        break;
-
-      case FMT_RC_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-      }
-}
-
-static void
-decode_rcpw ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RCPW_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RCPW_P:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x0f800000) >> 23;
-	break;
-
-      case FMT_RCPW_W:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x001f0000) >> 16;
-	break;
-
-      case FMT_RCPW_CONST4:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_RCPW_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rcr ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RCR_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RCR_S3:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f000000) >> 24;
-	break;
-
-      case FMT_RCR_CONST9:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x001ff000) >> 12;
-	break;
-
-      case FMT_RCR_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rcrr ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RCRR_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RCRR_S3:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f000000) >> 24;
-	break;
-
-      case FMT_RCRR_CONST4:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_RCRR_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rcrw ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RCRW_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RCRW_S3:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f000000) >> 24;
-	break;
-
-      case FMT_RCRW_W:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x001f0000) >> 16;
-	break;
-
-      case FMT_RCRW_CONST4:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_RCRW_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rlc ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RLC_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RLC_CONST16:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x0ffff000) >> 12;
-	break;
-
-      case FMT_RLC_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rr ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RR_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RR_N:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x00030000) >> 16;
-	break;
-
-      case FMT_RR_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_RR_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-        break;        
-      case FMT_RR_D_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rr1 ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RR1_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RR1_N:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x00030000) >> 16;
-	break;
-
-      case FMT_RR1_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_RR1_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rr2 ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RR2_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RR2_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_RR2_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rrpw ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RRPW_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RRPW_P:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x0f800000) >> 23;
-	break;
-
-      case FMT_RRPW_W:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x001f0000) >> 16;
-	break;
-
-      case FMT_RRPW_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_RRPW_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rrr ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RRR_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RRR_S3:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f000000) >> 24;
-	break;
-
-      case FMT_RRR_N:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x00030000) >> 16;
-	break;
-
-      case FMT_RRR_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_RRR_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rrr1 ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RRR1_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RRR1_S3:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f000000) >> 24;
-	break;
-
-      case FMT_RRR1_N:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x00030000) >> 16;
-	break;
-
-      case FMT_RRR1_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_RRR1_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rrr2 ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RRR2_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RRR2_S3:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f000000) >> 24;
-	break;
-
-      case FMT_RRR2_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_RRR2_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rrrr ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RRRR_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RRRR_S3:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f000000) >> 24;
-	break;
-
-      case FMT_RRRR_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_RRRR_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_rrrw ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_RRRW_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf0000000) >> 28;
-	break;
-
-      case FMT_RRRW_S3:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f000000) >> 24;
-	break;
-
-      case FMT_RRRW_W:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x001f0000) >> 16;
-	break;
-
-      case FMT_RRRW_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0000f000) >> 12;
-	break;
-
-      case FMT_RRRW_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
+/* Here come the operand fields of all instruction formats, indexed by
+   format and field (see FMT_* in opcode/tricore.h).  They used to be
+   decoded by one function per format, looping over the fields of an insn;
+   now the extractors of an insn are looked up once, when the dispatch
+   table is built, so decoding boils down to a few masks and shifts.  */
 
-static void
-decode_sys ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SYS_S1_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x00000f00) >> 8;
-	break;
-      }
-}
-
-static void
-decode_sb ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SB_DISP8:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0xff00) >> 8;
-	break;
-      }
-}
+#define FLD(f) [(f) - '0']
+#define REG(m, r) { 1, 1, { r }, { 0 }, { m } }
+#define VAL(m, r) { 0, 1, { r }, { 0 }, { m } }
 
-static void
-decode_sbc ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SBC_CONST4:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0xf000) >> 12;
-	break;
-
-      case FMT_SBC_DISP4:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x0f00) >> 8;
-        if (dec_insn.code->args[i] == 'x')
-          dec_insn.cexp[i] += (dec_insn.opcode & 0x80)? 0x10 : 0;
-	break;
-      }
-}
+/* off18 as used by the ABS and ABSB formats.  */
+#define OFF18 { 0, 4, { 16, 22, 12, 0 }, { 0, 0, 0, 2 }, \
+		{ 0x003f0000, 0xf0000000, 0x03c00000, 0x0000f000 } }
 
-static void
-decode_sbr ()
+static const struct field_extractor field_extractors[TRICORE_FMT_MAX][8] =
 {
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SBR_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf000) >> 12;
-	break;
-
-      case FMT_SBR_DISP4:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x0f00) >> 8;
-        if (dec_insn.code->args[i] == 'x')
-          dec_insn.cexp[i] += (dec_insn.opcode & 0x80)? 0x10 : 0;
-	break;
-      }
-}
+  [TRICORE_FMT_ABS] =
+  {
+    FLD (FMT_ABS_OFF18) = OFF18,
+    FLD (FMT_ABS_OFF18_14) = OFF18,
+    FLD (FMT_ABS_S1_D) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_ABSB] =
+  {
+    FLD (FMT_ABSB_OFF18) = OFF18,
+    FLD (FMT_ABSB_B) = VAL (0x00000800, 11),
+    FLD (FMT_ABSB_BPOS3) = VAL (0x00000700, 8),
+  },
+  [TRICORE_FMT_B] =
+  {
+    FLD (FMT_B_DISP24) = { 0, 2, { 16, 0 }, { 0, 8 },
+			   { 0xffff0000, 0x0000ff00 } },
+  },
+  [TRICORE_FMT_BIT] =
+  {
+    FLD (FMT_BIT_D) = REG (0xf0000000, 28),
+    FLD (FMT_BIT_P2) = VAL (0x0f800000, 23),
+    FLD (FMT_BIT_P1) = VAL (0x001f0000, 16),
+    FLD (FMT_BIT_S2) = REG (0x0000f000, 12),
+    FLD (FMT_BIT_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_BO] =
+  {
+    FLD (FMT_BO_OFF10) = { 0, 2, { 16, 22 }, { 0, 0 },
+			   { 0x003f0000, 0xf0000000 } },
+    FLD (FMT_BO_S2) = REG (0x0000f000, 12),
+    FLD (FMT_BO_S1_D) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_BOL] =
+  {
+    FLD (FMT_BOL_OFF16) = { 0, 3, { 16, 22, 12 }, { 0, 0, 0 },
+			    { 0x003f0000, 0xf0000000, 0x0fc00000 } },
+    FLD (FMT_BOL_S2) = REG (0x0000f000, 12),
+    FLD (FMT_BOL_S1_D) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_BRC] =
+  {
+    FLD (FMT_BRC_DISP15) = VAL (0x7fff0000, 16),
+    FLD (FMT_BRC_CONST4) = VAL (0x0000f000, 12),
+    FLD (FMT_BRC_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_BRN] =
+  {
+    FLD (FMT_BRN_DISP15) = VAL (0x7fff0000, 16),
+    FLD (FMT_BRN_N) = { 0, 2, { 12, 3 }, { 0, 0 },
+			{ 0x0000f000, 0x00000080 } },
+    FLD (FMT_BRN_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_BRR] =
+  {
+    FLD (FMT_BRR_DISP15) = VAL (0x7fff0000, 16),
+    FLD (FMT_BRR_S2) = REG (0x0000f000, 12),
+    FLD (FMT_BRR_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RC] =
+  {
+    FLD (FMT_RC_D) = REG (0xf0000000, 28),
+    FLD (FMT_RC_CONST9) = VAL (0x001ff000, 12),
+    FLD (FMT_RC_CONST10) = VAL (0x003ff000, 12),
+    FLD (FMT_RC_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RCPW] =
+  {
+    FLD (FMT_RCPW_D) = REG (0xf0000000, 28),
+    FLD (FMT_RCPW_P) = VAL (0x0f800000, 23),
+    FLD (FMT_RCPW_W) = VAL (0x001f0000, 16),
+    FLD (FMT_RCPW_CONST4) = VAL (0x0000f000, 12),
+    FLD (FMT_RCPW_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RCR] =
+  {
+    FLD (FMT_RCR_D) = REG (0xf0000000, 28),
+    FLD (FMT_RCR_S3) = REG (0x0f000000, 24),
+    FLD (FMT_RCR_CONST9) = VAL (0x001ff000, 12),
+    FLD (FMT_RCR_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RCRR] =
+  {
+    FLD (FMT_RCRR_D) = REG (0xf0000000, 28),
+    FLD (FMT_RCRR_S3) = REG (0x0f000000, 24),
+    FLD (FMT_RCRR_CONST4) = VAL (0x0000f000, 12),
+    FLD (FMT_RCRR_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RCRW] =
+  {
+    FLD (FMT_RCRW_D) = REG (0xf0000000, 28),
+    FLD (FMT_RCRW_S3) = REG (0x0f000000, 24),
+    FLD (FMT_RCRW_W) = VAL (0x001f0000, 16),
+    FLD (FMT_RCRW_CONST4) = VAL (0x0000f000, 12),
+    FLD (FMT_RCRW_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RLC] =
+  {
+    FLD (FMT_RLC_D) = REG (0xf0000000, 28),
+    FLD (FMT_RLC_CONST16) = VAL (0x0ffff000, 12),
+    FLD (FMT_RLC_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RR] =
+  {
+    FLD (FMT_RR_D) = REG (0xf0000000, 28),
+    FLD (FMT_RR_N) = VAL (0x00030000, 16),
+    FLD (FMT_RR_S2) = REG (0x0000f000, 12),
+    FLD (FMT_RR_S1) = REG (0x00000f00, 8),
+    FLD (FMT_RR_D_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RR1] =
+  {
+    FLD (FMT_RR1_D) = REG (0xf0000000, 28),
+    FLD (FMT_RR1_N) = VAL (0x00030000, 16),
+    FLD (FMT_RR1_S2) = REG (0x0000f000, 12),
+    FLD (FMT_RR1_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RR2] =
+  {
+    FLD (FMT_RR2_D) = REG (0xf0000000, 28),
+    FLD (FMT_RR2_S2) = REG (0x0000f000, 12),
+    FLD (FMT_RR2_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RRPW] =
+  {
+    FLD (FMT_RRPW_D) = REG (0xf0000000, 28),
+    FLD (FMT_RRPW_P) = VAL (0x0f800000, 23),
+    FLD (FMT_RRPW_W) = VAL (0x001f0000, 16),
+    FLD (FMT_RRPW_S2) = REG (0x0000f000, 12),
+    FLD (FMT_RRPW_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RRR] =
+  {
+    FLD (FMT_RRR_D) = REG (0xf0000000, 28),
+    FLD (FMT_RRR_S3) = REG (0x0f000000, 24),
+    FLD (FMT_RRR_N) = VAL (0x00030000, 16),
+    FLD (FMT_RRR_S2) = REG (0x0000f000, 12),
+    FLD (FMT_RRR_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RRR1] =
+  {
+    FLD (FMT_RRR1_D) = REG (0xf0000000, 28),
+    FLD (FMT_RRR1_S3) = REG (0x0f000000, 24),
+    FLD (FMT_RRR1_N) = VAL (0x00030000, 16),
+    FLD (FMT_RRR1_S2) = REG (0x0000f000, 12),
+    FLD (FMT_RRR1_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RRR2] =
+  {
+    FLD (FMT_RRR2_D) = REG (0xf0000000, 28),
+    FLD (FMT_RRR2_S3) = REG (0x0f000000, 24),
+    FLD (FMT_RRR2_S2) = REG (0x0000f000, 12),
+    FLD (FMT_RRR2_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RRRR] =
+  {
+    FLD (FMT_RRRR_D) = REG (0xf0000000, 28),
+    FLD (FMT_RRRR_S3) = REG (0x0f000000, 24),
+    FLD (FMT_RRRR_S2) = REG (0x0000f000, 12),
+    FLD (FMT_RRRR_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_RRRW] =
+  {
+    FLD (FMT_RRRW_D) = REG (0xf0000000, 28),
+    FLD (FMT_RRRW_S3) = REG (0x0f000000, 24),
+    FLD (FMT_RRRW_W) = VAL (0x001f0000, 16),
+    FLD (FMT_RRRW_S2) = REG (0x0000f000, 12),
+    FLD (FMT_RRRW_S1) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_SYS] =
+  {
+    FLD (FMT_SYS_S1_D) = REG (0x00000f00, 8),
+  },
+  [TRICORE_FMT_SB] =
+  {
+    FLD (FMT_SB_DISP8) = VAL (0xff00, 8),
+  },
+  [TRICORE_FMT_SBC] =
+  {
+    FLD (FMT_SBC_CONST4) = VAL (0xf000, 12),
+    FLD (FMT_SBC_DISP4) = VAL (0x0f00, 8),
+  },
+  [TRICORE_FMT_SBR] =
+  {
+    FLD (FMT_SBR_S2) = REG (0xf000, 12),
+    FLD (FMT_SBR_DISP4) = VAL (0x0f00, 8),
+  },
+  [TRICORE_FMT_SBRN] =
+  {
+    FLD (FMT_SBRN_N) = VAL (0xf000, 12),
+    FLD (FMT_SBRN_DISP4) = VAL (0x0f00, 8),
+  },
+  [TRICORE_FMT_SC] =
+  {
+    FLD (FMT_SC_CONST8) = VAL (0xff00, 8),
+  },
+  [TRICORE_FMT_SLR] =
+  {
+    FLD (FMT_SLR_S2) = REG (0xf000, 12),
+    FLD (FMT_SLR_D) = REG (0x0f00, 8),
+  },
+  [TRICORE_FMT_SLRO] =
+  {
+    FLD (FMT_SLRO_OFF4) = VAL (0xf000, 12),
+    FLD (FMT_SLRO_D) = REG (0x0f00, 8),
+  },
+  [TRICORE_FMT_SR] =
+  {
+    FLD (FMT_SR_S1_D) = REG (0x0f00, 8),
+  },
+  [TRICORE_FMT_SRC] =
+  {
+    FLD (FMT_SRC_CONST4) = VAL (0xf000, 12),
+    FLD (FMT_SRC_S1_D) = REG (0x0f00, 8),
+  },
+  [TRICORE_FMT_SRO] =
+  {
+    FLD (FMT_SRO_S2) = REG (0xf000, 12),
+    FLD (FMT_SRO_OFF4) = VAL (0x0f00, 8),
+  },
+  [TRICORE_FMT_SRR] =
+  {
+    FLD (FMT_SRR_S2) = REG (0xf000, 12),
+    FLD (FMT_SRR_S1_D) = REG (0x0f00, 8),
+  },
+  [TRICORE_FMT_SRRS] =
+  {
+    FLD (FMT_SRRS_S2) = REG (0xf000, 12),
+    FLD (FMT_SRRS_S1_D) = REG (0x0f00, 8),
+    FLD (FMT_SRRS_N) = VAL (0x00c0, 6),
+  },
+  [TRICORE_FMT_SSR] =
+  {
+    FLD (FMT_SSR_S2) = REG (0xf000, 12),
+    FLD (FMT_SSR_S1) = REG (0x0f00, 8),
+  },
+  [TRICORE_FMT_SSRO] =
+  {
+    FLD (FMT_SSRO_OFF4) = VAL (0xf000, 12),
+    FLD (FMT_SSRO_S1) = REG (0x0f00, 8),
+  },
+};
 
-static void
-decode_sbrn ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SBRN_N:
-	if (dec_insn.code->args[i] == '5')
-	  {
-            dec_insn.cexp[i] =  (dec_insn.opcode & 0xf000) >> 12;
-	    dec_insn.cexp[i] |= (dec_insn.opcode & 0x0080) >> 3;
-	  }
-	else  
-          dec_insn.cexp[i] =  (dec_insn.opcode & 0xf000) >> 12;
-	break;
-
-      case FMT_SBRN_DISP4:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x0f00) >> 8;
-	break;
-      }
-}
+#undef FLD
+#undef REG
+#undef VAL
+#undef OFF18
 
-static void
-decode_sc ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SC_CONST8:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0xff00) >> 8;
-	break;
-      }
-}
+/* Fill in the field extractors of DEC, the decoder of insn CODE, whose
+   opcode is masked by OPMASK.  */
 
 static void
-decode_slr ()
+init_insn_decoder (struct insn_decoder *dec, opcode_t *code,
+		   unsigned long opmask)
 {
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SLR_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf000) >> 12;
-	break;
-
-      case FMT_SLR_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f00) >> 8;
-	break;
-      }
-}
+  int i, field;
+  const struct field_extractor *fx;
 
-static void
-decode_slro ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SLRO_OFF4:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0xf000) >> 12;
-	break;
-
-      case FMT_SLRO_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f00) >> 8;
-	break;
-      }
-}
+  dec->code = code;
+  dec->mask = opmask;
+  dec->nfields = 0;
+  for (i = 0; i < code->nr_operands && i < MAX_OPS; ++i)
+    {
+      field = code->fields[i] - '0';
+      if (field <= 0 || field >= 8)
+	continue;
 
-static void
-decode_sr ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SR_S1_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f00) >> 8;
-	break;
-      }
-}
+      fx = &field_extractors[code->format][field];
+      if (fx->npieces == 0)
+	continue;
 
-static void
-decode_src ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SRC_CONST4:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0xf000) >> 12;
-	break;
-
-      case FMT_SRC_S1_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f00) >> 8;
-	break;
-      }
-}
+      dec->operand[dec->nfields] = i;
+      dec->fields[dec->nfields] = *fx;
 
-static void
-decode_sro ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SRO_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf000) >> 12;
-	break;
-
-      case FMT_SRO_OFF4:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x0f00) >> 8;
-	break;
-      }
-}
+      /* 5-bit displacements and bit numbers have their MSB in bit 7.  */
+      if (((code->format == TRICORE_FMT_SBC && code->fields[i] == FMT_SBC_DISP4)
+	   || (code->format == TRICORE_FMT_SBR && code->fields[i] == FMT_SBR_DISP4))
+	  && code->args[i] == 'x')
+	{
+	  struct field_extractor *f = &dec->fields[dec->nfields];
 
-static void
-decode_srr ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SRR_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf000) >> 12;
-	break;
-
-      case FMT_SRR_S1_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f00) >> 8;
-	break;
-      }
-}
+	  f->mask[f->npieces] = 0x80;
+	  f->rshift[f->npieces] = 3;
+	  f->npieces++;
+	}
+      else if (code->format == TRICORE_FMT_SBRN && code->fields[i] == FMT_SBRN_N
+	       && code->args[i] == '5')
+	{
+	  struct field_extractor *f = &dec->fields[dec->nfields];
 
-static void
-decode_srrs ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SRRS_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf000) >> 12;
-	break;
-
-      case FMT_SRRS_S1_D:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f00) >> 8;
-	break;
-
-      case FMT_SRRS_N:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0x00c0) >> 6;
-	break;
-      }
+	  f->mask[f->npieces] = 0x80;
+	  f->rshift[f->npieces] = 3;
+	  f->npieces++;
+	}
+      dec->nfields++;
+    }
 }
 
-static void
-decode_ssr ()
-{
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SSR_S2:
-        dec_insn.regs[i] = (dec_insn.opcode & 0xf000) >> 12;
-	break;
-
-      case FMT_SSR_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f00) >> 8;
-	break;
-      }
-}
+/* Return true if the insn decoded by DEC may have the primary opcode OP.  */
 
-static void
-decode_ssro ()
+static bool
+insn_may_match (const struct insn_decoder *dec, unsigned int op)
 {
-  int i;
-
-  for (i = 0; i < dec_insn.code->nr_operands; ++i)
-    switch (dec_insn.code->fields[i])
-      {
-      case FMT_SSRO_OFF4:
-        dec_insn.cexp[i] = (dec_insn.opcode & 0xf000) >> 12;
-	break;
-
-      case FMT_SSRO_S1:
-        dec_insn.regs[i] = (dec_insn.opcode & 0x0f00) >> 8;
-	break;
-      }
+  if (dec->code->len32 != (int) (op & 1))
+    return false;
+  if (op & dec->code->lose & 0xff)
+    return false;
+  return (op & dec->mask & 0xff) == (dec->code->opcode & 0xff);
 }
 
-/* Initialize the hash tables for instructions and SFRs.  */
+/* Build the lookup tables for instructions of ISA, whose opcode masks
+   are OPMASK.  SFRs are found by tricore_find_sfr_addr.  */
 
-static void
-init_hash_tables ()
+static struct tricore_dis_tables *
+init_hash_tables (tricore_isa isa, const unsigned long *opmask)
 {
+  struct tricore_dis_tables *tables;
+  struct insn_decoder *all;
+  unsigned int nall = 0, ndec = 0, op;
   opcode_t *pop;
   // TODO pcp_opcode_t *ppop;
-  sfr_t *psfr;
-  int i, idx;
+  int i, j;
 
-  insnlink = (struct insnlist *) xmalloc (NUMOPCS * sizeof (struct insnlist));
+  tables = (struct tricore_dis_tables *) xmalloc (sizeof (*tables));
   // TODO pcplink = (struct pcplist *) xmalloc (NUMPCPOPCS * sizeof (struct pcplist));
-  sfrlink = (struct sfrlist *) xmalloc (NUMSFRS * sizeof (struct sfrlist));
-  memset ((char *) insns, 0, sizeof (insns));
-  memset ((char *) insnlink, 0, NUMOPCS * sizeof (struct insnlist));
   // TODO memset ((char *) pcpinsns, 0, sizeof (pcpinsns));
   // TODO memset ((char *) pcplink, 0, NUMPCPOPCS * sizeof (struct pcplist));
-  memset ((char *) sfrs, 0, sizeof (sfrs));
-  memset ((char *) sfrlink, 0, NUMSFRS * sizeof (struct sfrlist));
 
-  for (i = 0, pop = tricore_opcodes; i < NUMOPCS; ++i, ++pop)
+  /* Set up the decoders of all insns of ISA, then sort them by primary
+     opcode.  Insns sharing a primary opcode are tried in reverse table
+     order, so that later entries of tricore_opcodes take precedence over
+     earlier ones, as they always did.  An insn whose opcode doesn't fix
+     all bits of the primary opcode is entered for each primary opcode
+     it may match.  */
+  all = (struct insn_decoder *) xmalloc (NUMOPCS * sizeof (*all));
+  for (i = NUMOPCS - 1; i >= 0; --i)
     {
-      if (!MATCHES_ISA (pop->isa))
-        continue;
+      pop = &tricore_opcodes[i];
+      if (MATCHES_ISA (pop->isa, isa))
+	init_insn_decoder (&all[nall++], pop, opmask[pop->format]);
+    }
+
+  for (op = 0; op < 256; ++op)
+    for (j = 0; j < (int) nall; ++j)
+      if (insn_may_match (&all[j], op))
+	++ndec;
 
-      idx = pop->opcode & 0x3f;
-      if (insns[idx])
-	insnlink[i].next = insns[idx];
-      insns[idx] = &insnlink[i];
-      insnlink[i].code = pop;
+  tables->decoders = (struct insn_decoder *)
+    xmalloc ((ndec + 1) * sizeof (struct insn_decoder));
+  for (op = 0, ndec = 0; op < 256; ++op)
+    {
+      tables->dispatch[op] = ndec;
+      for (j = 0; j < (int) nall; ++j)
+	if (insn_may_match (&all[j], op))
+	  tables->decoders[ndec++] = all[j];
     }
+  tables->dispatch[256] = ndec;
+  free (all);
 /*
  TODO
   for (i = 0, ppop = pcp_opcodes; i < NUMPCPOPCS; ++i, ++ppop)
@@ -1115,51 +561,65 @@ init_hash_tables ()
       pcplink[i].code = ppop;
     }
 */
-  for (i = 0, psfr = tricore_sfrs; i < NUMSFRS; ++i, ++psfr)
-    {
-      if (!MATCHES_ISA (psfr->isa))
-        continue;
+  return tables;
+}
 
-      idx = psfr->addr & 0xff;
-      if (sfrs[idx])
-        sfrlink[i].next = sfrs[idx];
-      sfrs[idx] = &sfrlink[i];
-      sfrlink[i].sfr = psfr;
-    }
+/* Return the lookup tables of the TriCore flavour MACH, which uses the
+   instruction set ISA, building them if this is the first use of ISA.  */
+
+static const struct tricore_dis_tables *
+get_dis_tables (unsigned long mach, tricore_isa isa)
+{
+  const struct tricore_dis_tables *tables, *expected;
+  struct tricore_dis_tables *mine;
+  unsigned long opmask[TRICORE_FMT_MAX];
+  unsigned int i;
+
+  for (i = 0; i < NUM_ISAS - 1; ++i)
+    if (tricore_isas[i] == isa)
+      break;
+
+  tables = LOAD_TABLES (dis_tables[i]);
+  if (tables != NULL)
+    return tables;
+
+  memset (opmask, 0, sizeof (opmask));
+  if (!tricore_get_opmask (mach, opmask))
+    tricore_get_opmask (EF_EABI_TRICORE_V1_6_2, opmask);
+  mine = init_hash_tables (isa, opmask);
+
+  /* If another thread got here first, use its tables and drop ours.  */
+  expected = NULL;
+  if (PUBLISH_TABLES (dis_tables[i], expected, mine))
+    return mine;
+  free (mine->decoders);
+  free (mine);
+  return expected;
 }
 
 /* Return the name of the core register (SFR) located at offset ADDR.  */
 
 static const char *
-find_core_reg (unsigned long addr)
+find_core_reg (struct tricore_private_data *priv, unsigned long addr)
 {
-  struct sfrlist *psfr;
-  int idx = addr & 0xff;
+  sfr_t *psfr = tricore_find_sfr_addr (addr, priv->isa);
 
-  for (psfr = sfrs[idx]; psfr != NULL; psfr = psfr->next)
-    if ((psfr->sfr->addr == addr) && MATCHES_ISA (psfr->sfr->isa))
-      return psfr->sfr->name;
-
-  return (char *) 0;
+  return psfr != NULL ? psfr->name : NULL;
 }
 
 /* Print the decoded TriCore instruction starting at MEMADDR.  */
 
 static void
-print_decoded_insn (bfd_vma memaddr, struct disassemble_info *info)
+print_decoded_insn (struct tricore_private_data *priv, bfd_vma memaddr,
+		    struct disassemble_info *info)
 {
-  opcode_t *insn = dec_insn.code;
+  struct decoded_insn *dec_insn = &priv->dec_insn;
+  opcode_t *insn = dec_insn->code;
   int i, needs_creg = 0, need_comma;
   const char *creg;
   bfd_vma abs;
-  static bfd_vma next_addr = 0;
-  static bool expect_lea = false;
-#define NO_AREG	16
-  static int load_areg[NO_AREG] = {false, false, false, false, false, false,
-	  false, false, false, false, false, false, false, false, false, false}; 
-  static unsigned long load_hi_addr[NO_AREG] = {0};
-  static unsigned long load_addr = 0;
-  static bool print_symbolic_address = false;
+  int *load_areg = priv->load_areg;
+  unsigned long *load_hi_addr = priv->load_hi_addr;
 #define DPRINT (*info->fprintf_func)
 #define DFILE info->stream
 
@@ -1168,10 +628,10 @@ print_decoded_insn (bfd_vma memaddr, struct disassemble_info *info)
       && ((insn->nr_operands == 1)
           || ((insn->nr_operands == 3)
 	      && (insn->args[2] == 'n')
-              && (dec_insn.regs[0] == dec_insn.regs[1])
-	      && (dec_insn.cexp[2] == 0))))
+              && (dec_insn->regs[0] == dec_insn->regs[1])
+	      && (dec_insn->cexp[2] == 0))))
     {
-      DPRINT (DFILE, "not %%d%d", dec_insn.regs[0]);
+      DPRINT (DFILE, "not %%d%d", dec_insn->regs[0]);
       return;
     }
   else
@@ -1191,18 +651,18 @@ print_decoded_insn (bfd_vma memaddr, struct disassemble_info *info)
      if we can be reasonably sure that it is part of the load sequence
      described above.  Note that "lea" is used here as a generic insn;
      it actually may also be any load or store instruction.  */
-  if (memaddr != next_addr)
-    expect_lea = print_symbolic_address = false;
-  next_addr = memaddr + (insn->len32 ? 4 : 2);
+  if (memaddr != priv->next_addr)
+    priv->expect_lea = priv->print_symbolic_address = false;
+  priv->next_addr = memaddr + (insn->len32 ? 4 : 2);
 
   if (!strcmp (insn->name, "movh.a"))
     {
-      load_areg[dec_insn.regs[0]] = true;
-      load_hi_addr[dec_insn.regs[0]] = dec_insn.cexp[1] << 16;
-      expect_lea = true;
-      print_symbolic_address = false;
+      load_areg[dec_insn->regs[0]] = true;
+      load_hi_addr[dec_insn->regs[0]] = dec_insn->cexp[1] << 16;
+      priv->expect_lea = true;
+      priv->print_symbolic_address = false;
     }
-  else if (expect_lea
+  else if (priv->expect_lea
 	   && (!strcmp (insn->name, "lea")
 	       || !strncmp (insn->name, "ld.", 3)
 	       || !strncmp (insn->name, "st.", 3)
@@ -1215,33 +675,33 @@ print_decoded_insn (bfd_vma memaddr, struct disassemble_info *info)
 	       || !strncmp (insn->name, "ld.", 3)
 	       || !strcmp (insn->name, "ldmst"))
 		 ) {
-	     if ((true == load_areg[dec_insn.regs[1]]))
+	     if ((true == load_areg[dec_insn->regs[1]]))
 	    {
-	      load_addr = load_hi_addr[dec_insn.regs[1]] + (short) dec_insn.cexp[2];
-	      print_symbolic_address = true;
+	      priv->load_addr = load_hi_addr[dec_insn->regs[1]] + (short) dec_insn->cexp[2];
+	      priv->print_symbolic_address = true;
 	    }
       }
-	  else if (true == load_areg[dec_insn.regs[0]])
+	  else if (true == load_areg[dec_insn->regs[0]])
 	    {
-	      load_addr = load_hi_addr[dec_insn.regs[0]] + (short) dec_insn.cexp[1];
-	      print_symbolic_address = true;
+	      priv->load_addr = load_hi_addr[dec_insn->regs[0]] + (short) dec_insn->cexp[1];
+	      priv->print_symbolic_address = true;
 	    }
 	}
     }
   else
-    print_symbolic_address = false;
+    priv->print_symbolic_address = false;
 
   if (!strncmp(insn->name,"ld.a",4))
-		load_areg[dec_insn.regs[0]] = false;
+		load_areg[dec_insn->regs[0]] = false;
   else
   if (!strncmp(insn->name,"add.a",5) 
 	|| !strncmp(insn->name,"sub.a",5)
 	|| !strcmp(insn->name,"mov.a")
 	|| !strncmp(insn->name,"addsc.a",7))
-		load_areg[dec_insn.regs[0]] = false;
+		load_areg[dec_insn->regs[0]] = false;
   else
   if (!strcmp(insn->name,"mov.aa"))
-	load_areg[dec_insn.regs[0]] = load_areg[dec_insn.regs[1]];
+	load_areg[dec_insn->regs[0]] = load_areg[dec_insn->regs[1]];
   else
   if (!strncmp(insn->name,"call",4)) {
 	for (i = 2; i < 8; i++)
@@ -1265,39 +725,39 @@ print_decoded_insn (bfd_vma memaddr, struct disassemble_info *info)
       switch (insn->args[i])
         {
 	case 'd':
-	  DPRINT (DFILE, "%%d%d", dec_insn.regs[i]);
+	  DPRINT (DFILE, "%%d%d", dec_insn->regs[i]);
 	  break;
 
 	case 'g':
-	  DPRINT (DFILE, "%%d%dl", dec_insn.regs[i]);
+	  DPRINT (DFILE, "%%d%dl", dec_insn->regs[i]);
 	  break;
 
 	case 'G':
-	  DPRINT (DFILE, "%%d%du", dec_insn.regs[i]);
+	  DPRINT (DFILE, "%%d%du", dec_insn->regs[i]);
 	  break;
 
 	case '-':
-	  DPRINT (DFILE, "%%d%dll", dec_insn.regs[i]);
+	  DPRINT (DFILE, "%%d%dll", dec_insn->regs[i]);
 	  break;
 
 	case '+':
-	  DPRINT (DFILE, "%%d%duu", dec_insn.regs[i]);
+	  DPRINT (DFILE, "%%d%duu", dec_insn->regs[i]);
 	  break;
 
 	case 'l':
-	  DPRINT (DFILE, "%%d%dlu", dec_insn.regs[i]);
+	  DPRINT (DFILE, "%%d%dlu", dec_insn->regs[i]);
 	  break;
 
 	case 'L':
-	  DPRINT (DFILE, "%%d%dul", dec_insn.regs[i]);
+	  DPRINT (DFILE, "%%d%dul", dec_insn->regs[i]);
 	  break;
 
 	case 'D':
-	  DPRINT (DFILE, "%%e%d", dec_insn.regs[i]);
+	  DPRINT (DFILE, "%%e%d", dec_insn->regs[i]);
 	  break;
 
 	case 'Q':
-	  DPRINT (DFILE, "%%q%d", dec_insn.regs[i]);
+	  DPRINT (DFILE, "%%q%d", dec_insn->regs[i]);
 	  break;
 
 	case 'i':
@@ -1306,11 +766,11 @@ print_decoded_insn (bfd_vma memaddr, struct disassemble_info *info)
 
 	case 'a':
 	case 'A':
-	  if (dec_insn.regs[i] == 10) {
+	  if (dec_insn->regs[i] == 10) {
 	    DPRINT (DFILE, "%%sp");
  	  }
 	  else
-	    DPRINT (DFILE, "%%a%d", dec_insn.regs[i]);
+	    DPRINT (DFILE, "%%a%d", dec_insn->regs[i]);
 	  break;
 
 	case 'I':
@@ -1323,10 +783,10 @@ print_decoded_insn (bfd_vma memaddr, struct disassemble_info *info)
 
 	case 'k':
         case '6':
-	  dec_insn.cexp[i] <<= 1;
+	  dec_insn->cexp[i] <<= 1;
 	  /* Fall through. */
 	case 'v':
-	  dec_insn.cexp[i] <<= 1;
+	  dec_insn->cexp[i] <<= 1;
 	  /* Fall through. */
 	case '1':
 	case '2':
@@ -1337,95 +797,95 @@ print_decoded_insn (bfd_vma memaddr, struct disassemble_info *info)
 	case 'h':
 	case 'n':
 	case 'M':
-	  DPRINT (DFILE, "%llu", dec_insn.cexp[i]);
+	  DPRINT (DFILE, "%llu", dec_insn->cexp[i]);
 	  break;
 
 	case '4':
-	  if (dec_insn.cexp[i] & 0x8)
-	    dec_insn.cexp[i] |= ~0xf;
-	  DPRINT (DFILE, "%lld", dec_insn.cexp[i]);
+	  if (dec_insn->cexp[i] & 0x8)
+	    dec_insn->cexp[i] |= ~0xf;
+	  DPRINT (DFILE, "%lld", dec_insn->cexp[i]);
 	  break;
 
 	case 'F':
-	  if (dec_insn.cexp[i] & 0x10)
-	    dec_insn.cexp[i] |= ~0x1f;
-	  DPRINT (DFILE, "%lld", dec_insn.cexp[i]);
+	  if (dec_insn->cexp[i] & 0x10)
+	    dec_insn->cexp[i] |= ~0x1f;
+	  DPRINT (DFILE, "%lld", dec_insn->cexp[i]);
 	  break;
 
 	case '9':
-	  if (dec_insn.cexp[i] & 0x100)
-	    dec_insn.cexp[i] |= ~0x1ff;
-	  DPRINT (DFILE, "%lld", dec_insn.cexp[i]);
+	  if (dec_insn->cexp[i] & 0x100)
+	    dec_insn->cexp[i] |= ~0x1ff;
+	  DPRINT (DFILE, "%lld", dec_insn->cexp[i]);
 	  break;
 
 	case '0':
-	  if (dec_insn.cexp[i] & 0x200)
-	    dec_insn.cexp[i] |= ~0x3ff;
-	  DPRINT (DFILE, "%lld", dec_insn.cexp[i]);
-	  if (print_symbolic_address)
+	  if (dec_insn->cexp[i] & 0x200)
+	    dec_insn->cexp[i] |= ~0x3ff;
+	  DPRINT (DFILE, "%lld", dec_insn->cexp[i]);
+	  if (priv->print_symbolic_address)
 	    {
 	      DPRINT (DFILE, " <");
-	      (*info->print_address_func) (load_addr, info);
+	      (*info->print_address_func) (priv->load_addr, info);
 	      DPRINT (DFILE, ">");
 	    }
 	  break;
 
 	case 'w':
-	  if (dec_insn.cexp[i] & 0x8000)
-	    dec_insn.cexp[i] |= ~0xffff;
-	  DPRINT (DFILE, "%lld", dec_insn.cexp[i]);
-	  if (print_symbolic_address)
+	  if (dec_insn->cexp[i] & 0x8000)
+	    dec_insn->cexp[i] |= ~0xffff;
+	  DPRINT (DFILE, "%lld", dec_insn->cexp[i]);
+	  if (priv->print_symbolic_address)
 	    {
 	      DPRINT (DFILE, " <");
-	      (*info->print_address_func) (load_addr, info);
+	      (*info->print_address_func) (priv->load_addr, info);
 	      DPRINT (DFILE, ">");
 	    }
 	  break;
 
 	case 't':
-	  abs =  (dec_insn.cexp[i] & 0x00003fff);
-	  abs |= (dec_insn.cexp[i] & 0x0003c000) << 14;
+	  abs =  (dec_insn->cexp[i] & 0x00003fff);
+	  abs |= (dec_insn->cexp[i] & 0x0003c000) << 14;
 	  (*info->print_address_func) (abs, info);
 	  break;
 
 	case 'T':
-	  abs =  (dec_insn.cexp[i] & 0x000fffff) << 1;
-	  abs |= (dec_insn.cexp[i] & 0x00f00000) << 8;
+	  abs =  (dec_insn->cexp[i] & 0x000fffff) << 1;
+	  abs |= (dec_insn->cexp[i] & 0x00f00000) << 8;
 	  (*info->print_address_func) (abs, info);
 	  break;
 
 	case 'V':
-	  abs =  (dec_insn.cexp[i] & 0x0003ffff) << 14;
+	  abs =  (dec_insn->cexp[i] & 0x0003ffff) << 14;
 	  (*info->print_address_func) (abs, info);
 	  break;
 
 	case 'o':
-	  if (dec_insn.cexp[i] & 0x4000)
-	    dec_insn.cexp[i] |= ~0x7fff;
-	  abs = (dec_insn.cexp[i] << 1) + memaddr;
+	  if (dec_insn->cexp[i] & 0x4000)
+	    dec_insn->cexp[i] |= ~0x7fff;
+	  abs = (dec_insn->cexp[i] << 1) + memaddr;
 	  (*info->print_address_func) (abs, info);
 	  break;
 
 	case 'O':
-	  if (dec_insn.cexp[i] & 0x800000)
-	    dec_insn.cexp[i] |= ~0xffffff;
-	  abs = (dec_insn.cexp[i] << 1) + memaddr;
+	  if (dec_insn->cexp[i] & 0x800000)
+	    dec_insn->cexp[i] |= ~0xffffff;
+	  abs = (dec_insn->cexp[i] << 1) + memaddr;
 	  (*info->print_address_func) (abs, info);
 	  break;
 
 	case 'R':
-	  if (dec_insn.cexp[i] & 0x80)
-	    dec_insn.cexp[i] |= ~0xff;
-	  abs = (dec_insn.cexp[i] << 1) + memaddr;
+	  if (dec_insn->cexp[i] & 0x80)
+	    dec_insn->cexp[i] |= ~0xff;
+	  abs = (dec_insn->cexp[i] << 1) + memaddr;
 	  (*info->print_address_func) (abs, info);
 	  break;
 
 	case 'r':
-	  dec_insn.cexp[i] |= ~0xf;
+	  dec_insn->cexp[i] |= ~0xf;
 	  /* Fall through. */
 	case 'm':
 	case 'x':
-	  abs = (dec_insn.cexp[i] << 1) + memaddr;
+	  abs = (dec_insn->cexp[i] << 1) + memaddr;
 	  (*info->print_address_func) (abs, info);
 	  break;
 	  
@@ -1435,24 +895,24 @@ print_decoded_insn (bfd_vma memaddr, struct disassemble_info *info)
 	case 'W':
 	  if (needs_creg)
 	    {
-	      creg = find_core_reg (dec_insn.cexp[i]);
+	      creg = find_core_reg (priv, dec_insn->cexp[i]);
 	      if (creg)
 	        DPRINT (DFILE, "%s", creg);
 	      else
-	        DPRINT (DFILE, "$0x%04llx (unknown SFR)", dec_insn.cexp[i]);
+	        DPRINT (DFILE, "$0x%04llx (unknown SFR)", dec_insn->cexp[i]);
 	    }
 	  else
-	    DPRINT (DFILE, "%lld", dec_insn.cexp[i]);
+	    DPRINT (DFILE, "%lld", dec_insn->cexp[i]);
 	  break;
 
 	case '&':
-	  dec_insn.regs[i] = 10;
+	  dec_insn->regs[i] = 10;
 	  /* Fall through. */ 
 	case '@':
-	  if (dec_insn.regs[i] == 10)
+	  if (dec_insn->regs[i] == 10)
 	    DPRINT (DFILE, "[%%sp]");
 	  else
-	    DPRINT (DFILE, "[%%a%d]", dec_insn.regs[i]);
+	    DPRINT (DFILE, "[%%a%d]", dec_insn->regs[i]);
 	  if (need_comma)
 	    {
 	      if (
@@ -1466,18 +926,18 @@ print_decoded_insn (bfd_vma memaddr, struct disassemble_info *info)
 	  break;
 
 	case '<':
-	  if (dec_insn.regs[i] == 10)
+	  if (dec_insn->regs[i] == 10)
 	    DPRINT (DFILE, "[+%%sp]");
 	  else
-	    DPRINT (DFILE, "[+%%a%d]", dec_insn.regs[i]);
+	    DPRINT (DFILE, "[+%%a%d]", dec_insn->regs[i]);
 	  need_comma = 0;
 	  break;
 
 	case '>':
-	  if (dec_insn.regs[i] == 10)
+	  if (dec_insn->regs[i] == 10)
 	    DPRINT (DFILE, "[%%sp+]");
 	  else
-	    DPRINT (DFILE, "[%%a%d+]", dec_insn.regs[i]);
+	    DPRINT (DFILE, "[%%a%d+]", dec_insn->regs[i]);
 	  if (need_comma)
 	    {
 	      if ((insn->args[i+1] == 'a') || (insn->args[i+1] == 'd'))
@@ -1488,25 +948,25 @@ print_decoded_insn (bfd_vma memaddr, struct disassemble_info *info)
 	  break;
 
 	case '*':
-	  if (dec_insn.regs[i] == 10)
+	  if (dec_insn->regs[i] == 10)
 	    DPRINT (DFILE, "[%%sp+c]");
 	  else
-	    DPRINT (DFILE, "[%%a%d+c]", dec_insn.regs[i]);
+	    DPRINT (DFILE, "[%%a%d+c]", dec_insn->regs[i]);
 	  need_comma = 0;
 	  break;
 
 	case '#':
-	  if (dec_insn.regs[i] == 10)
+	  if (dec_insn->regs[i] == 10)
 	    DPRINT (DFILE, "[%%sp+r]");
 	  else
-	    DPRINT (DFILE, "[%%a%d+r]", dec_insn.regs[i]);
+	    DPRINT (DFILE, "[%%a%d+r]", dec_insn->regs[i]);
 	  break;
 
 	case '?':
-	  if (dec_insn.regs[i] == 10)
+	  if (dec_insn->regs[i] == 10)
 	    DPRINT (DFILE, "[%%sp+i]");
 	  else
-	    DPRINT (DFILE, "[%%a%d+i]", dec_insn.regs[i]);
+	    DPRINT (DFILE, "[%%a%d+i]", dec_insn->regs[i]);
 	  break;
 
 	case 'S':
@@ -1529,33 +989,42 @@ print_decoded_insn (bfd_vma memaddr, struct disassemble_info *info)
    decoded insn.  Return the number of actually decoded bytes.  */
 
 static int
-decode_tricore_insn (bfd_vma memaddr,
+decode_tricore_insn (struct tricore_private_data *priv,
+     bfd_vma memaddr,
      unsigned long insn,
      int len32,
      struct disassemble_info *info)
 {
-  int idx = insn & 0x3f;
-  struct insnlist *pinsn;
-  unsigned long mask;
-  tricore_fmt fmt;
+  const struct tricore_dis_tables *tables = priv->tables;
+  const struct insn_decoder *dec = &tables->decoders[tables->dispatch[insn & 0xff]];
+  const struct insn_decoder *end = &tables->decoders[tables->dispatch[(insn & 0xff) + 1]];
+  struct decoded_insn *dec_insn = &priv->dec_insn;
+  int i, j;
 
   /* Try to find the instruction matching the given opcode.  */
-  for (pinsn = insns[idx]; pinsn != NULL; pinsn = pinsn->next)
+  for (; dec < end; ++dec)
     {
-      if ((pinsn->code->len32 != len32)
-          || (insn & pinsn->code->lose))
+      if (((insn & dec->mask) != dec->code->opcode)
+          || (insn & dec->code->lose))
         continue;
 
-      fmt = pinsn->code->format;
-      mask = tricore_opmask[fmt];
-      if ((insn & mask) != pinsn->code->opcode)
-        continue;
+      /* A valid instruction was found.  Decode its operands and go
+	 print it.  */
+      dec_insn->code = dec->code;
+      dec_insn->opcode = insn;
+      for (i = 0; i < dec->nfields; ++i)
+	{
+	  const struct field_extractor *fx = &dec->fields[i];
+	  unsigned long val = 0;
 
-      /* A valid instruction was found.  Go print it. */
-      dec_insn.code = pinsn->code;
-      dec_insn.opcode = insn;
-      decode[fmt] ();
-      print_decoded_insn (memaddr, info);
+	  for (j = 0; j < fx->npieces; ++j)
+	    val |= ((insn & fx->mask[j]) >> fx->rshift[j]) << fx->lshift[j];
+	  if (fx->is_reg)
+	    dec_insn->regs[dec->operand[i]] = val;
+	  else
+	    dec_insn->cexp[dec->operand[i]] = val;
+	}
+      print_decoded_insn (priv, memaddr, info);
       return len32 ? 4 : 2;
     }
 
@@ -1874,50 +1343,57 @@ print_insn_tricore (bfd_vma memaddr,
   bfd_byte buffer[4];
   int len32 = 0, failure;
   unsigned long insn = 0;
-  unsigned long mach = 0;
+  struct tricore_private_data *priv = info->private_data;
+
+  if (priv == NULL)
+    {
+      priv = (struct tricore_private_data *) xcalloc (1, sizeof (*priv));
+      priv->mach = ~info->mach;
+      info->private_data = priv;
+    }
 
-  if (!initialized)
+  /* The ISA is taken from INFO on each call, so a disassembler may be
+     reused for another flavour of TriCore.  */
+  if (priv->tables == NULL || priv->mach != info->mach)
     {
-      mach = tricore_elf32_convert_eflags(info->mach);
+      unsigned long mach = tricore_elf32_convert_eflags (info->mach);
+
       /* Set the current instruction set architecture.  */
       switch (mach & EF_EABI_TRICORE_CORE_MASK)
         {
           case EF_EABI_TRICORE_V1_1:
-            current_isa = TRICORE_RIDER_A;
+            priv->isa = TRICORE_RIDER_A;
             break;
           case EF_EABI_TRICORE_V1_2:
-            current_isa = TRICORE_V1_2;
+            priv->isa = TRICORE_V1_2;
             break;
           case EF_EABI_TRICORE_V1_3:
-            current_isa = TRICORE_V1_3;
+            priv->isa = TRICORE_V1_3;
             break;
           case EF_EABI_TRICORE_V1_3_1:
-            current_isa = TRICORE_V1_3_1;
+            priv->isa = TRICORE_V1_3_1;
             break;
           case EF_EABI_TRICORE_V1_6:
-            current_isa = TRICORE_V1_6;
+            priv->isa = TRICORE_V1_6;
             break;
           case EF_EABI_TRICORE_V1_6_1:
-            current_isa = TRICORE_V1_6_1;
+            priv->isa = TRICORE_V1_6_1;
             break;
           case EF_EABI_TRICORE_V1_6_2:
-            current_isa = TRICORE_V1_6_2;
+            priv->isa = TRICORE_V1_6_2;
             break;
 	  case EF_EABI_TRICORE_V1_8:
-            current_isa = TRICORE_V1_8;
+            priv->isa = TRICORE_V1_8;
             break;
           default:
             (*info->fprintf_func) (info->stream, "unknown tricore architecture using TC1.6.2 instruction set");
-            current_isa = TRICORE_V1_6_2;
+            priv->isa = TRICORE_V1_6_2;
             break;
           }
 
-      /* Initialize architecture-dependent variables.  */
-      tricore_init_arch_vars (mach);
-
-      /* Initialize the hash tables.  */
-      init_hash_tables ();
-      initialized = 1;
+      /* Look up (or build) the tables of this ISA.  */
+      priv->tables = get_dis_tables (mach, priv->isa);
+      priv->mach = info->mach;
     }
 
   memset ((char *) buffer, 0, sizeof (buffer));
@@ -1963,7 +1439,7 @@ print_insn_tricore (bfd_vma memaddr,
   else
     insn = bfd_getl16 (buffer);
 
-  return decode_tricore_insn (memaddr, insn, len32, info);
+  return decode_tricore_insn (priv, memaddr, insn, len32, info);
 }
 
 /* End of tricore-dis.c.  */
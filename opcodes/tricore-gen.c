@@ -0,0 +1,291 @@
+/* Generate the TriCore opcode and SFR hash tables.
+   Copyright (C) 2026 Free Software Foundation, Inc.
+
+   This file is part of the GNU opcodes library.
+
+   This library is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3, or (at your option)
+   any later version.
+
+   It is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+   License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this file; see the file COPYING.  If not, write to the
+   Free Software Foundation, 51 Franklin Street - Fifth Floor, Boston,
+   MA 02110-1301, USA.  */
+
+/* This program generates tricore-tbl.h from the tables in tricore-opc.c:
+   perfect hash tables of the opcode mnemonics, of the SFR names and of
+   the SFR addresses.  */
+
+#include "sysdep.h"
+#include <stdio.h>
+#include "libiberty.h"
+
+#include "tricore-opc.c"
+#include "tricore-hash.h"
+
+/* The largest displacement tried for a bucket.  */
+#define MAX_DISP 0xffff
+
+struct key
+{
+  uint32_t hash;
+  int index;			/* The table entry the key stands for.  */
+  unsigned int bucket;
+};
+
+static const char *program_name;
+
+static void ATTRIBUTE_NORETURN
+fail (const char *message, const char *table)
+{
+  fprintf (stderr, "%s: %s table: %s\n", program_name, table, message);
+  exit (EXIT_FAILURE);
+}
+
+static unsigned int
+power_of_two (unsigned int n)
+{
+  unsigned int p = 1;
+
+  while (p < n)
+    p <<= 1;
+  return p;
+}
+
+static void
+print_array (const char *type, const char *name, const char *size,
+	     const int *values, unsigned int n)
+{
+  unsigned int i;
+
+  printf ("static const %s %s[%s] =\n{", type, name, size);
+  for (i = 0; i < n; i++)
+    printf ("%s%d%s", i % 12 == 0 ? "\n  " : " ", values[i],
+	    i + 1 < n ? "," : "");
+  printf ("\n};\n\n");
+}
+
+/* Build a perfect hash table of the NKEYS keys in KEYS, and print it as
+   the arrays tricore_NAME_disp and tricore_NAME_slot.  The slots hold
+   the index of the key, or -1.  */
+
+static void
+make_table (const char *name, const char *macro, const char *what,
+	    struct key *keys, unsigned int nkeys)
+{
+  unsigned int nslots = power_of_two (nkeys + nkeys / 4);
+  unsigned int nbuckets = power_of_two ((nkeys + 3) / 4);
+  unsigned int *order, *count, *trial;
+  int *disp, *slot;
+  unsigned int i, j, b, d;
+  char buf[100];
+
+  for (i = 0; i < nkeys; i++)
+    for (j = i + 1; j < nkeys; j++)
+      if (keys[i].hash == keys[j].hash)
+	fail ("two keys have the same hash", name);
+
+  count = XCNEWVEC (unsigned int, nbuckets);
+  for (i = 0; i < nkeys; i++)
+    {
+      keys[i].bucket = tricore_hash_bucket (keys[i].hash, nbuckets);
+      count[keys[i].bucket]++;
+    }
+
+  /* Place the keys of the fullest buckets first, while the table is
+     still mostly empty.  */
+  order = XNEWVEC (unsigned int, nbuckets);
+  for (b = 0; b < nbuckets; b++)
+    order[b] = b;
+  for (i = 1; i < nbuckets; i++)
+    for (j = i; j > 0 && count[order[j - 1]] < count[order[j]]; j--)
+      {
+	b = order[j];
+	order[j] = order[j - 1];
+	order[j - 1] = b;
+      }
+
+  disp = XCNEWVEC (int, nbuckets);
+  slot = XNEWVEC (int, nslots);
+  for (i = 0; i < nslots; i++)
+    slot[i] = -1;
+  trial = XNEWVEC (unsigned int, nkeys);
+
+  for (b = 0; b < nbuckets && count[order[b]] != 0; b++)
+    {
+      unsigned int bucket = order[b];
+
+      for (d = 0; d <= MAX_DISP; d++)
+	{
+	  unsigned int n = 0;
+
+	  for (i = 0; i < nkeys; i++)
+	    if (keys[i].bucket == bucket)
+	      {
+		unsigned int s = tricore_hash_slot (keys[i].hash, d, nslots);
+
+		if (slot[s] != -1)
+		  break;
+		for (j = 0; j < n; j++)
+		  if (trial[j] == s)
+		    break;
+		if (j < n)
+		  break;
+		trial[n++] = s;
+	      }
+	  if (i == nkeys)
+	    break;
+	}
+      if (d > MAX_DISP)
+	fail ("no displacement found", name);
+
+      disp[bucket] = d;
+      for (i = 0; i < nkeys; i++)
+	if (keys[i].bucket == bucket)
+	  slot[tricore_hash_slot (keys[i].hash, d, nslots)] = keys[i].index;
+    }
+
+  /* Check that every key is found in its slot.  */
+  for (i = 0; i < nkeys; i++)
+    {
+      b = tricore_hash_bucket (keys[i].hash, nbuckets);
+      if (slot[tricore_hash_slot (keys[i].hash, disp[b], nslots)]
+	  != keys[i].index)
+	fail ("key not found", name);
+    }
+
+  printf ("/* %s.  */\n\n", what);
+  printf ("#define TRICORE_%s_BUCKETS %u\n", macro, nbuckets);
+  printf ("#define TRICORE_%s_SLOTS %u\n\n", macro, nslots);
+  sprintf (buf, "tricore_%s_disp", name);
+  sprintf (buf + 50, "TRICORE_%s_BUCKETS", macro);
+  print_array ("unsigned short", buf, buf + 50, disp, nbuckets);
+  sprintf (buf, "tricore_%s_slot", name);
+  sprintf (buf + 50, "TRICORE_%s_SLOTS", macro);
+  print_array ("short", buf, buf + 50, slot, nslots);
+
+  free (trial);
+  free (slot);
+  free (disp);
+  free (order);
+  free (count);
+}
+
+int
+main (int argc, char **argv)
+{
+  struct key *keys;
+  int *chain;
+  unsigned int nkeys;
+  int i, j;
+
+  program_name = argv[0];
+  if (argc != 1)
+    {
+      fprintf (stderr, "Usage: %s > tricore-tbl.h\n", program_name);
+      return EXIT_FAILURE;
+    }
+
+  printf ("\
+/* This file is automatically generated by tricore-gen.  Do not edit!  */\n\
+/* Copyright (C) 2026 Free Software Foundation, Inc.\n\
+\n\
+   This file is part of the GNU opcodes library.\n\
+\n\
+   This library is free software; you can redistribute it and/or modify\n\
+   it under the terms of the GNU General Public License as published by\n\
+   the Free Software Foundation; either version 3, or (at your option)\n\
+   any later version.\n\
+\n\
+   It is distributed in the hope that it will be useful, but WITHOUT\n\
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY\n\
+   or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public\n\
+   License for more details.\n\
+\n\
+   You should have received a copy of the GNU General Public License\n\
+   along with this program; if not, write to the Free Software\n\
+   Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston,\n\
+   MA 02110-1301, USA.  */\n\
+\n");
+
+  printf ("#define TRICORE_TBL_NUMOPCODES %d\n", tricore_numopcodes);
+  printf ("#define TRICORE_TBL_NUMSFRS %d\n\n", tricore_numsfrs);
+
+  keys = XNEWVEC (struct key, tricore_numopcodes + tricore_numsfrs);
+
+  /* Opcodes, by mnemonic.  A key stands for the first opcode of that
+     name.  */
+  nkeys = 0;
+  for (i = 0; i < tricore_numopcodes; i++)
+    {
+      for (j = 0; j < i; j++)
+	if (strcmp (tricore_opcodes[j].name, tricore_opcodes[i].name) == 0)
+	  break;
+      if (j < i)
+	continue;
+      keys[nkeys].hash = tricore_hash_string (tricore_opcodes[i].name);
+      keys[nkeys++].index = i;
+    }
+  make_table ("opcode", "OPCODE", "Opcodes by mnemonic", keys, nkeys);
+
+  /* SFRs, by name.  A key stands for the first SFR of that name, and
+     the others follow in table order.  */
+  chain = XNEWVEC (int, tricore_numsfrs);
+  nkeys = 0;
+  for (i = 0; i < tricore_numsfrs; i++)
+    {
+      chain[i] = -1;
+      for (j = i + 1; j < tricore_numsfrs; j++)
+	if (strcmp (tricore_sfrs[j].name, tricore_sfrs[i].name) == 0)
+	  {
+	    chain[i] = j;
+	    break;
+	  }
+      for (j = 0; j < i; j++)
+	if (strcmp (tricore_sfrs[j].name, tricore_sfrs[i].name) == 0)
+	  break;
+      if (j < i)
+	continue;
+      keys[nkeys].hash = tricore_hash_string (tricore_sfrs[i].name);
+      keys[nkeys++].index = i;
+    }
+  make_table ("sfr_name", "SFR_NAME", "SFRs by name", keys, nkeys);
+  printf ("/* The next SFR with the same name, or -1.  */\n\n");
+  print_array ("short", "tricore_sfr_name_next", "TRICORE_TBL_NUMSFRS",
+	       chain, tricore_numsfrs);
+
+  /* SFRs, by address.  A key stands for the last SFR at that address,
+     and the others follow in reverse table order.  */
+  nkeys = 0;
+  for (i = tricore_numsfrs - 1; i >= 0; i--)
+    {
+      chain[i] = -1;
+      for (j = i - 1; j >= 0; j--)
+	if (tricore_sfrs[j].addr == tricore_sfrs[i].addr)
+	  {
+	    chain[i] = j;
+	    break;
+	  }
+      for (j = i + 1; j < tricore_numsfrs; j++)
+	if (tricore_sfrs[j].addr == tricore_sfrs[i].addr)
+	  break;
+      if (j < tricore_numsfrs)
+	continue;
+      keys[nkeys].hash = tricore_hash_addr (tricore_sfrs[i].addr);
+      keys[nkeys++].index = i;
+    }
+  make_table ("sfr_addr", "SFR_ADDR", "SFRs by address", keys, nkeys);
+  printf ("/* The previous SFR at the same address, or -1.  */\n\n");
+  print_array ("short", "tricore_sfr_addr_prev", "TRICORE_TBL_NUMSFRS",
+	       chain, tricore_numsfrs);
+
+  free (chain);
+  free (keys);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,154 @@
+/* Look up TriCore opcodes and SFRs.
+   Copyright (C) 2026 Free Software Foundation, Inc.
+
+   This file is part of the GNU opcodes library.
+
+   This library is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3, or (at your option)
+   any later version.
+
+   It is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+   License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this file; see the file COPYING.  If not, write to the
+   Free Software Foundation, 51 Franklin Street - Fifth Floor, Boston,
+   MA 02110-1301, USA.  */
+
+/* The tables searched here are generated from tricore-opc.c by
+   tricore-gen, so nothing needs to be set up at run time, and each
+   lookup hashes its key once and compares it with a single entry.  */
+
+#include "sysdep.h"
+#include "opcode/tricore.h"
+#include "tricore-hash.h"
+#include "tricore-tbl.h"
+
+#define MATCHES_ISA(isa, cur_isa) \
+	  (((isa) == TRICORE_GENERIC) \
+	   || (((isa) & TRICORE_ISA_MASK) & (cur_isa)))
+
+typedef struct tricore_opcode opcode_t;
+typedef const struct tricore_core_register sfr_t;
+
+/* Return the first opcode named NAME, or NULL if there is none.  The
+   other opcodes of that name follow it in tricore_opcodes.  */
+
+opcode_t *
+tricore_find_opcode (const char *name)
+{
+  uint32_t h = tricore_hash_string (name);
+  unsigned int b = tricore_hash_bucket (h, TRICORE_OPCODE_BUCKETS);
+  int i = tricore_opcode_slot[tricore_hash_slot (h, tricore_opcode_disp[b],
+						 TRICORE_OPCODE_SLOTS)];
+
+  if (i < 0 || strcmp (tricore_opcodes[i].name, name) != 0)
+    return NULL;
+  return &tricore_opcodes[i];
+}
+
+/* Return the first SFR named NAME that exists in ISA, or NULL.  */
+
+sfr_t *
+tricore_find_sfr (const char *name, tricore_isa isa)
+{
+  uint32_t h = tricore_hash_string (name);
+  unsigned int b = tricore_hash_bucket (h, TRICORE_SFR_NAME_BUCKETS);
+  int i = tricore_sfr_name_slot[tricore_hash_slot (h,
+						   tricore_sfr_name_disp[b],
+						   TRICORE_SFR_NAME_SLOTS)];
+
+  if (i < 0 || strcmp (tricore_sfrs[i].name, name) != 0)
+    return NULL;
+  for (; i >= 0; i = tricore_sfr_name_next[i])
+    if (MATCHES_ISA (tricore_sfrs[i].isa, isa))
+      return &tricore_sfrs[i];
+  return NULL;
+}
+
+/* Return the last SFR in tricore_sfrs at ADDR that exists in ISA, or
+   NULL.  */
+
+sfr_t *
+tricore_find_sfr_addr (unsigned long addr, tricore_isa isa)
+{
+  uint32_t h = tricore_hash_addr (addr);
+  unsigned int b = tricore_hash_bucket (h, TRICORE_SFR_ADDR_BUCKETS);
+  int i = tricore_sfr_addr_slot[tricore_hash_slot (h,
+						   tricore_sfr_addr_disp[b],
+						   TRICORE_SFR_ADDR_SLOTS)];
+
+  if (i < 0 || tricore_sfrs[i].addr != addr)
+    return NULL;
+  for (; i >= 0; i = tricore_sfr_addr_prev[i])
+    if (MATCHES_ISA (tricore_sfrs[i].isa, isa))
+      return &tricore_sfrs[i];
+  return NULL;
+}
+
+/* Check that the generated tables agree with tricore_opcodes and
+   tricore_sfrs, by looking up every entry in every ISA and comparing
+   the result with a linear search.  Return NULL if they do, else a
+   message saying what is wrong.  tricore-tbl.h has to be regenerated
+   whenever one of these tables changes.  */
+
+const char *
+tricore_check_hash_tables (void)
+{
+  static const tricore_isa isas[] =
+  {
+    TRICORE_RIDER_A, TRICORE_V1_2, TRICORE_V1_3, TRICORE_V1_3_1,
+    TRICORE_V1_6, TRICORE_V1_6_1, TRICORE_V1_6_2, TRICORE_V1_8
+  };
+  unsigned int k;
+  int i, j;
+
+  if (tricore_numopcodes != TRICORE_TBL_NUMOPCODES
+      || tricore_numsfrs != TRICORE_TBL_NUMSFRS)
+    return "tricore-tbl.h is out of date";
+
+  for (i = 0; i < tricore_numopcodes; i++)
+    {
+      for (j = 0; j < i; j++)
+	if (strcmp (tricore_opcodes[j].name, tricore_opcodes[i].name) == 0)
+	  break;
+      if (tricore_find_opcode (tricore_opcodes[i].name) != &tricore_opcodes[j])
+	return "wrong opcode found by name";
+    }
+
+  for (k = 0; k < sizeof (isas) / sizeof (isas[0]); k++)
+    for (i = 0; i < tricore_numsfrs; i++)
+      {
+	sfr_t *expect = NULL;
+
+	for (j = 0; j < tricore_numsfrs; j++)
+	  if (strcmp (tricore_sfrs[j].name, tricore_sfrs[i].name) == 0
+	      && MATCHES_ISA (tricore_sfrs[j].isa, isas[k]))
+	    {
+	      expect = &tricore_sfrs[j];
+	      break;
+	    }
+	if (tricore_find_sfr (tricore_sfrs[i].name, isas[k]) != expect)
+	  return "wrong SFR found by name";
+
+	expect = NULL;
+	for (j = tricore_numsfrs - 1; j >= 0; j--)
+	  if (tricore_sfrs[j].addr == tricore_sfrs[i].addr
+	      && MATCHES_ISA (tricore_sfrs[j].isa, isas[k]))
+	    {
+	      expect = &tricore_sfrs[j];
+	      break;
+	    }
+	if (tricore_find_sfr_addr (tricore_sfrs[i].addr, isas[k]) != expect)
+	  return "wrong SFR found by address";
+      }
+
+  if (tricore_find_opcode ("") != NULL
+      || tricore_find_sfr ("", TRICORE_V1_8) != NULL)
+    return "empty name found";
+
+  return NULL;
+}
@@ -0,0 +1,84 @@
+/* Hash functions for the TriCore opcode and SFR tables.
+   Copyright (C) 2026 Free Software Foundation, Inc.
+
+   This file is part of the GNU opcodes library.
+
+   This library is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3, or (at your option)
+   any later version.
+
+   It is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+   License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this file; see the file COPYING.  If not, write to the
+   Free Software Foundation, 51 Franklin Street - Fifth Floor, Boston,
+   MA 02110-1301, USA.  */
+
+/* tricore-gen builds the perfect hash tables in tricore-tbl.h with
+   these functions, and tricore-hash.c looks keys up with them, so the
+   two must always agree.
+
+   A key is hashed once.  The low bits of the hash select a bucket, and
+   the displacement stored for that bucket, mixed into the hash, gives
+   the key's slot.  tricore-gen chooses the displacements so that no two
+   keys share a slot; a lookup then compares the key of that one slot.  */
+
+#include <stdint.h>
+
+/* Hash the NUL-terminated string S (FNV-1a).  */
+
+static inline uint32_t
+tricore_hash_string (const char *s)
+{
+  uint32_t h = 2166136261u;
+
+  while (*s != '\0')
+    h = (h ^ (unsigned char) *s++) * 16777619u;
+  return h;
+}
+
+/* Hash the SFR address ADDR.  Different 32-bit addresses never have
+   the same hash.  */
+
+static inline uint32_t
+tricore_hash_addr (unsigned long addr)
+{
+  uint32_t h = (uint32_t) (addr ^ (addr >> 16 >> 16));
+
+  /* Each step is invertible, so all bits are mixed without collisions.  */
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+  return h;
+}
+
+/* Return the bucket of hash H in a table with NBUCKETS buckets, which
+   is a power of two.  */
+
+static inline unsigned int
+tricore_hash_bucket (uint32_t h, unsigned int nbuckets)
+{
+  return h & (nbuckets - 1);
+}
+
+/* Return the slot of hash H with displacement DISP in a table with
+   NSLOTS slots, which is a power of two.  */
+
+static inline unsigned int
+tricore_hash_slot (uint32_t h, unsigned int disp, unsigned int nslots)
+{
+  uint32_t x = h ^ (disp * 0x9e3779b1u);
+
+  x ^= x >> 16;
+  x *= 0x85ebca6bu;
+  x ^= x >> 13;
+  x *= 0xc2b2ae35u;
+  x ^= x >> 16;
+  return x & (nslots - 1);
+}
@@ -0,0 +1,337 @@
+/* This file is automatically generated by tricore-gen.  Do not edit!  */
+/* Copyright (C) 2026 Free Software Foundation, Inc.
+
+   This file is part of the GNU opcodes library.
+
+   This library is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3, or (at your option)
+   any later version.
+
+   It is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+   License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston,
+   MA 02110-1301, USA.  */
+
+#define TRICORE_TBL_NUMOPCODES 1104
+#define TRICORE_TBL_NUMSFRS 346
+
+/* Opcodes by mnemonic.  */
+
+#define TRICORE_OPCODE_BUCKETS 128
+#define TRICORE_OPCODE_SLOTS 1024
+
+static const unsigned short tricore_opcode_disp[TRICORE_OPCODE_BUCKETS] =
+{
+  0, 5, 0, 0, 0, 0, 1, 1, 2, 2, 9, 3,
+  0, 2, 0, 5, 3, 0, 1, 0, 0, 3, 0, 2,
+  0, 1, 0, 1, 0, 2, 0, 3, 0, 2, 1, 0,
+  0, 0, 9, 0, 5, 3, 0, 0, 0, 4, 0, 3,
+  8, 4, 2, 0, 0, 4, 0, 0, 4, 1, 0, 0,
+  0, 5, 0, 2, 2, 1, 4, 0, 1, 1, 1, 0,
+  0, 1, 0, 2, 2, 0, 2, 0, 1, 8, 0, 0,
+  9, 1, 0, 0, 0, 1, 4, 0, 8, 1, 2, 5,
+  7, 0, 0, 1, 1, 5, 4, 1, 0, 0, 3, 1,
+  2, 5, 1, 4, 2, 0, 1, 0, 0, 0, 1, 1,
+  0, 0, 0, 0, 0, 0, 1, 0
+};
+
+static const short tricore_opcode_slot[TRICORE_OPCODE_SLOTS] =
+{
+  703, 185, -1, -1, 491, 474, -1, -1, -1, 578, -1, 888,
+  28, -1, -1, 247, -1, -1, 303, -1, -1, -1, 111, 483,
+  -1, 928, 1027, 1035, -1, 1091, -1, 179, 545, -1, 54, 88,
+  -1, 910, 42, 460, 156, 301, -1, 311, -1, 396, 1077, -1,
+  -1, 1095, 494, 558, -1, -1, 812, 161, 692, -1, 563, -1,
+  -1, 260, 896, -1, -1, 647, 698, 621, -1, -1, -1, -1,
+  184, -1, 680, -1, 505, 924, -1, 966, -1, -1, -1, 233,
+  -1, -1, 799, -1, -1, -1, 1081, 264, -1, -1, 493, 858,
+  -1, -1, 871, -1, 1101, -1, 250, 175, 187, 1074, 607, 77,
+  -1, 252, -1, -1, 123, 212, 183, -1, -1, -1, -1, 854,
+  299, -1, -1, -1, -1, -1, 1041, -1, 172, 590, 8, -1,
+  -1, 516, -1, -1, -1, -1, -1, -1, 221, 5, 1023, -1,
+  -1, -1, 159, -1, -1, -1, -1, -1, 654, 231, -1, -1,
+  -1, 1043, 923, 462, 154, 869, -1, -1, 305, -1, 192, -1,
+  -1, -1, -1, -1, 815, 908, -1, 1038, 338, 706, -1, -1,
+  -1, -1, -1, -1, -1, 906, -1, -1, -1, -1, -1, -1,
+  -1, 30, -1, -1, -1, -1, 1045, 780, -1, 500, 33, 256,
+  258, -1, 851, 641, 839, 634, -1, -1, 874, -1, 477, -1,
+  1071, 1, 151, -1, -1, 35, -1, -1, -1, -1, -1, 206,
+  492, 98, 190, 1072, 1007, -1, -1, 916, 210, -1, 263, 278,
+  -1, -1, -1, -1, -1, -1, 860, -1, -1, -1, 269, -1,
+  -1, -1, -1, 837, -1, -1, 816, 201, 150, 344, 174, -1,
+  -1, 1044, 281, 181, -1, 56, -1, 498, 270, -1, 806, -1,
+  -1, -1, -1, 218, -1, -1, -1, 720, -1, 241, 230, -1,
+  -1, -1, 582, -1, -1, 845, 841, -1, 487, -1, 620, 246,
+  -1, -1, 86, 117, 1082, 369, 645, -1, 1037, -1, -1, -1,
+  -1, -1, 277, 177, 714, -1, -1, -1, 736, 41, 407, -1,
+  -1, -1, 403, 4, 766, -1, -1, 848, 741, -1, -1, -1,
+  499, 902, 353, -1, 340, 696, -1, 120, 164, -1, -1, -1,
+  232, -1, -1, 158, -1, -1, -1, -1, -1, 784, 261, -1,
+  16, -1, 1087, -1, 429, 602, -1, -1, -1, -1, -1, -1,
+  -1, 476, -1, 894, -1, -1, 36, 904, 153, -1, 809, 865,
+  -1, 193, 296, -1, 485, -1, 1070, -1, -1, 670, 297, 1047,
+  644, -1, 518, 764, -1, -1, 586, -1, -1, -1, -1, -1,
+  554, -1, -1, 1039, -1, 864, -1, 879, 653, -1, 688, 310,
+  -1, 652, 313, 214, -1, 771, 66, -1, 138, -1, -1, 788,
+  484, -1, 0, -1, -1, 817, -1, 1062, 782, 208, -1, 279,
+  609, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 914, 646, 790, -1, 29, 1084, -1, 833, -1, -1,
+  890, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  870, -1, 329, -1, 315, -1, -1, -1, -1, -1, -1, -1,
+  -1, 835, -1, 482, 163, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 1093, 648, -1, 1099, -1, 624, -1,
+  -1, 1097, -1, 1073, -1, -1, -1, -1, 598, -1, -1, -1,
+  922, 74, 251, 919, 1046, -1, -1, 1069, 136, 617, 616, 287,
+  -1, -1, 309, -1, -1, -1, -1, -1, 14, 257, -1, -1,
+  332, -1, 52, 1103, 604, 12, 825, -1, -1, -1, -1, -1,
+  -1, -1, 31, -1, -1, 912, -1, -1, 319, -1, 832, -1,
+  254, -1, 855, -1, -1, -1, -1, 194, -1, -1, -1, -1,
+  -1, -1, -1, -1, 852, 173, 199, 142, -1, 224, -1, 24,
+  147, 1076, -1, -1, -1, 824, -1, -1, 930, 704, -1, -1,
+  -1, -1, -1, -1, 932, 283, 803, -1, 618, 9, 79, 757,
+  857, -1, -1, -1, 197, 63, -1, -1, -1, -1, 478, -1,
+  -1, -1, 486, -1, -1, 126, -1, 189, -1, -1, 321, -1,
+  574, -1, -1, 444, 526, 542, -1, -1, -1, 470, 350, -1,
+  -1, 846, 3, -1, -1, 255, -1, -1, 752, -1, -1, -1,
+  -1, -1, 934, -1, 892, -1, -1, 229, 225, 200, -1, -1,
+  216, 45, 81, -1, -1, -1, 90, -1, -1, -1, -1, 977,
+  1088, -1, 62, 7, -1, 917, 244, -1, -1, 999, -1, -1,
+  712, 334, 885, -1, -1, -1, 129, 78, -1, -1, -1, -1,
+  -1, -1, 2, 40, 15, -1, -1, -1, 95, 973, -1, 613,
+  756, 758, -1, -1, 729, -1, -1, -1, -1, -1, -1, 165,
+  -1, -1, -1, -1, -1, 612, -1, -1, -1, -1, -1, 317,
+  1034, -1, -1, -1, -1, -1, -1, -1, -1, -1, 676, 157,
+  -1, 684, -1, -1, 1042, 288, -1, 820, -1, 794, 238, 765,
+  196, 843, 202, 284, 1048, 1049, 875, -1, -1, -1, -1, 1036,
+  551, -1, -1, 27, -1, -1, -1, -1, 528, 176, -1, -1,
+  900, -1, -1, -1, -1, 64, -1, -1, 72, -1, -1, -1,
+  -1, -1, 525, -1, 144, -1, 876, -1, -1, -1, 622, 276,
+  -1, -1, 868, 1006, 1085, 920, 984, -1, 610, 614, 186, -1,
+  -1, 152, -1, -1, -1, -1, -1, 34, 132, -1, -1, -1,
+  638, -1, 237, 1055, -1, -1, 11, -1, -1, -1, -1, -1,
+  -1, 802, -1, -1, 1080, -1, 198, -1, -1, 1078, 280, -1,
+  608, 594, -1, 708, -1, -1, 732, -1, -1, 39, -1, -1,
+  659, 343, -1, 68, -1, -1, -1, -1, -1, 146, -1, 1031,
+  -1, -1, 1083, -1, -1, 82, 530, 818, -1, 901, -1, 348,
+  -1, 235, -1, -1, -1, -1, -1, -1, -1, 619, 106, -1,
+  -1, -1, 859, -1, 1068, -1, -1, 76, -1, 473, -1, 520,
+  -1, -1, -1, -1, 282, 814, -1, -1, -1, 103, 414, -1,
+  -1, -1, -1, -1, 861, 882, -1, -1, -1, -1, -1, 170,
+  -1, -1, -1, 850, -1, 856, -1, -1, -1, 831, 70, 935,
+  114, -1, 536, -1, 171, 437, 723, -1, -1, 606, 951, 13,
+  -1, 188, -1, 178, -1, -1, 249, 847, 672, -1, -1, 191,
+  253, -1, 605, 921, 534, -1, -1, 381, -1, -1, 811, 1025,
+  -1, -1, -1, -1, 203, 330, -1, 245, 43, -1, 265, 468,
+  -1, 155, -1, 1075
+};
+
+/* SFRs by name.  */
+
+#define TRICORE_SFR_NAME_BUCKETS 128
+#define TRICORE_SFR_NAME_SLOTS 512
+
+static const unsigned short tricore_sfr_name_disp[TRICORE_SFR_NAME_BUCKETS] =
+{
+  4, 0, 1, 0, 0, 0, 0, 2, 0, 0, 4, 0,
+  0, 0, 3, 0, 0, 3, 1, 0, 1, 4, 1, 1,
+  7, 0, 2, 5, 6, 4, 0, 0, 2, 0, 0, 7,
+  3, 3, 1, 1, 1, 0, 4, 2, 8, 0, 0, 12,
+  1, 1, 7, 0, 0, 4, 7, 5, 0, 2, 0, 11,
+  1, 1, 0, 2, 0, 0, 7, 5, 13, 0, 0, 2,
+  1, 5, 2, 0, 6, 3, 0, 0, 10, 3, 3, 0,
+  1, 0, 5, 6, 0, 4, 1, 0, 0, 2, 2, 1,
+  0, 1, 2, 1, 2, 1, 1, 6, 1, 0, 0, 11,
+  4, 0, 17, 7, 5, 0, 13, 0, 20, 2, 3, 18,
+  0, 12, 20, 0, 0, 0, 1, 2
+};
+
+static const short tricore_sfr_name_slot[TRICORE_SFR_NAME_SLOTS] =
+{
+  -1, 136, 199, -1, 145, -1, -1, 249, -1, -1, -1, 301,
+  268, 160, 180, 157, 219, 28, -1, 186, -1, 81, 321, 311,
+  50, 203, -1, -1, 345, 32, 287, -1, 317, -1, -1, -1,
+  252, 290, 140, -1, 212, -1, 142, 9, 315, -1, 178, 264,
+  230, -1, 143, 292, -1, -1, 325, 263, -1, 93, 133, -1,
+  148, 194, -1, 132, 254, -1, 7, 318, -1, 213, -1, -1,
+  319, 282, 101, -1, 250, -1, 96, -1, 206, 242, 299, 188,
+  -1, -1, 31, -1, 327, 67, 283, 146, 175, -1, 155, -1,
+  131, 35, 61, -1, 324, -1, 220, -1, 23, 265, -1, 312,
+  204, 228, 113, -1, 251, 297, 150, 56, 16, -1, -1, 151,
+  342, 166, 156, 83, 162, 105, 12, -1, -1, -1, 79, -1,
+  296, 5, 300, -1, 59, 294, 340, -1, 307, 6, 72, 109,
+  310, -1, 305, -1, 221, -1, 214, 124, 36, 189, -1, 121,
+  -1, 253, 19, 99, -1, -1, 248, 191, -1, -1, 286, 14,
+  -1, -1, -1, 284, -1, 316, 339, -1, 262, 170, 302, 120,
+  293, 314, 197, 153, 95, 295, -1, 24, -1, -1, 40, -1,
+  73, 167, 82, 20, -1, 246, 238, 211, -1, 118, 261, -1,
+  69, 102, 85, -1, 107, -1, 335, 147, 125, 98, -1, 208,
+  58, 135, 259, 117, -1, 215, 70, -1, 27, 338, 241, -1,
+  127, 337, 218, 168, 77, 33, 237, -1, -1, -1, -1, -1,
+  269, 116, 49, 86, -1, 232, 66, -1, 10, 202, -1, 183,
+  -1, -1, -1, -1, -1, 51, -1, 158, 112, 234, 108, -1,
+  89, 198, 260, -1, 137, -1, 184, -1, -1, 84, 210, 2,
+  126, -1, 271, 104, -1, -1, 22, -1, 179, 74, -1, -1,
+  229, -1, -1, -1, 57, 38, -1, 103, 201, 289, 306, 39,
+  -1, -1, 236, -1, 111, 344, 320, -1, 78, -1, -1, 334,
+  -1, 128, -1, 138, 3, 207, -1, 11, 149, -1, -1, 244,
+  -1, -1, -1, 328, 231, -1, -1, 185, 205, -1, -1, 75,
+  190, 326, 313, 304, 48, 30, 247, 34, 258, 235, 25, 174,
+  267, 52, 217, 285, 106, -1, 225, 100, 54, 176, 196, 323,
+  -1, -1, 332, 13, 139, 333, 90, -1, 245, -1, 55, -1,
+  -1, 209, 115, -1, 15, 309, -1, -1, 129, 226, 46, 270,
+  222, 123, 177, 63, 164, 0, 336, -1, -1, 169, 62, -1,
+  -1, 76, -1, -1, 165, -1, 291, 163, 223, -1, 239, -1,
+  68, -1, -1, -1, 343, 47, 88, 224, 80, 181, 21, -1,
+  -1, 288, 192, -1, -1, 65, 37, -1, -1, 272, 193, 53,
+  -1, 187, -1, 308, 8, 18, 60, -1, 94, 42, -1, 159,
+  266, 173, -1, 171, 43, 298, -1, 144, -1, -1, -1, 216,
+  64, 87, 152, -1, 161, 1, 114, 122, -1, 17, 4, 195,
+  227, -1, 322, 91, 331, -1, -1, 240, -1, 97, 154, 45,
+  -1, -1, -1, -1, -1, -1, 110, 200, 182, 303, -1, 29,
+  329, 233, -1, 119, -1, 243, -1, 141, 130, 92, 330, 134,
+  44, 41, 71, 341, -1, 172, -1, -1
+};
+
+/* The next SFR with the same name, or -1.  */
+
+static const short tricore_sfr_name_next[TRICORE_TBL_NUMSFRS] =
+{
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 26, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  255, 256, 257, -1, -1, -1, 273, 274, 275, 276, 277, 278,
+  279, 280, 281, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+/* SFRs by address.  */
+
+#define TRICORE_SFR_ADDR_BUCKETS 128
+#define TRICORE_SFR_ADDR_SLOTS 512
+
+static const unsigned short tricore_sfr_addr_disp[TRICORE_SFR_ADDR_BUCKETS] =
+{
+  5, 1, 1, 2, 0, 0, 0, 0, 0, 2, 1, 0,
+  1, 2, 0, 0, 0, 4, 1, 0, 0, 0, 2, 0,
+  0, 0, 1, 1, 4, 0, 1, 5, 0, 0, 0, 0,
+  2, 11, 2, 1, 2, 0, 8, 0, 5, 0, 1, 0,
+  5, 0, 2, 1, 0, 1, 0, 0, 0, 9, 4, 0,
+  0, 0, 4, 0, 0, 2, 0, 1, 4, 1, 1, 3,
+  0, 6, 1, 2, 0, 2, 0, 4, 3, 0, 0, 1,
+  0, 1, 0, 2, 0, 1, 8, 1, 2, 0, 0, 1,
+  9, 4, 0, 1, 1, 0, 0, 1, 0, 0, 11, 0,
+  2, 0, 0, 3, 1, 2, 0, 0, 2, 6, 11, 0,
+  4, 4, 11, 1, 2, 2, 0, 24
+};
+
+static const short tricore_sfr_addr_slot[TRICORE_SFR_ADDR_SLOTS] =
+{
+  152, -1, 282, -1, -1, -1, 234, 231, 23, -1, 59, 253,
+  265, 88, 224, -1, -1, 153, 64, -1, 302, -1, 61, -1,
+  -1, 176, -1, -1, 287, -1, -1, 326, -1, 96, 101, -1,
+  94, 213, 5, -1, 332, 103, 118, -1, 29, 139, 52, -1,
+  249, 84, 36, 216, 238, 141, 273, -1, 126, -1, 241, 25,
+  -1, 65, -1, 318, -1, 162, -1, 228, 305, 301, -1, 335,
+  177, -1, -1, -1, 159, 309, -1, -1, 167, 7, 203, 190,
+  107, 272, -1, 173, -1, -1, -1, 34, 37, 185, 174, -1,
+  1, -1, 214, -1, -1, -1, 66, -1, 261, -1, 42, 292,
+  -1, 240, 286, 71, -1, 308, 313, 322, 188, -1, 344, 67,
+  113, -1, 193, 310, 255, 22, -1, -1, -1, -1, -1, -1,
+  89, -1, 324, -1, 194, 291, -1, 320, -1, 208, 20, -1,
+  28, -1, -1, -1, 165, -1, -1, -1, 72, 35, 63, 151,
+  200, 244, 135, 225, 338, -1, -1, -1, 191, 124, -1, 166,
+  163, 104, 132, -1, 262, -1, 90, 285, -1, 293, 39, 289,
+  215, 333, -1, -1, 169, 319, -1, -1, 13, 340, -1, 157,
+  147, 268, 206, -1, 102, -1, -1, -1, -1, 227, 19, 53,
+  119, 60, -1, -1, -1, 40, 17, 218, -1, -1, -1, 55,
+  -1, -1, 260, 140, 220, -1, 329, -1, 41, 155, 246, -1,
+  158, 30, -1, -1, 233, 168, 257, 245, 300, 31, 312, 223,
+  184, -1, 325, 24, 252, 121, -1, 183, -1, 54, 109, -1,
+  266, -1, 290, 134, 229, -1, 331, 18, 164, 230, 221, 337,
+  -1, -1, -1, 129, -1, 195, -1, 98, -1, -1, 236, 281,
+  315, 271, 247, 321, -1, 278, -1, 280, -1, 138, 306, -1,
+  106, -1, -1, 131, 179, 342, -1, -1, 189, 154, 334, -1,
+  284, 74, -1, 171, 181, 304, 117, 196, 222, -1, -1, -1,
+  172, 180, 237, -1, 279, 296, 232, -1, -1, 123, -1, -1,
+  295, -1, 127, 212, 297, -1, -1, 15, 156, 258, -1, 114,
+  16, 303, 14, -1, -1, -1, 115, -1, 62, -1, 91, 58,
+  69, 21, 316, 345, -1, 226, 150, -1, 210, -1, 235, -1,
+  85, 283, 100, 270, 92, 199, -1, 182, 144, 175, -1, -1,
+  328, 143, -1, 27, -1, 105, 248, -1, 339, 43, -1, -1,
+  3, -1, -1, -1, 198, 307, -1, 202, 11, 250, 95, -1,
+  242, 145, 99, -1, 207, 219, 73, -1, 192, 274, -1, 128,
+  259, 256, 160, -1, 269, -1, 187, -1, -1, 93, 336, -1,
+  -1, -1, -1, 323, 205, 68, -1, 299, 97, -1, 170, 186,
+  -1, 9, -1, 86, 110, 201, -1, 263, -1, 125, 264, 149,
+  288, 56, 317, -1, 209, -1, 38, -1, -1, 161, 33, 146,
+  -1, 178, 148, 276, -1, -1, -1, 75, 197, -1, -1, 142,
+  -1, 57, -1, -1, 133, 136, -1, 267, 130, 87, 314, 327,
+  -1, -1, -1, 32, -1, 70, 211, -1, -1, -1, 343, -1,
+  217, -1, 137, -1, 341, -1, 330, 254, 298, 204, 275, -1,
+  -1, 111, 243, 294, -1, 277, 311, 251
+};
+
+/* The previous SFR at the same address, or -1.  */
+
+static const short tricore_sfr_addr_prev[TRICORE_TBL_NUMSFRS] =
+{
+  -1, 0, -1, 2, -1, 4, -1, 6, -1, 8, -1, 10,
+  -1, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 26, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 108, 112, -1, -1,
+  -1, -1, -1, -1, 120, 122, -1, -1, 44, 45, 46, 47,
+  48, 49, 50, 51, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, 76, 77, 78, 79, 80, 81, 82, 83,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  116, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  239, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+